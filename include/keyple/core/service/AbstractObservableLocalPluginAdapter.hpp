@@ -21,6 +21,7 @@
 #include "keyple/core/service/ObservablePlugin.hpp"
 #include "keyple/core/service/ObservationManagerAdapter.hpp"
 #include "keyple/core/service/cpp/Job.hpp"
+#include "keyple/core/service/cpp/MonitoringThreadPool.hpp"
 #include "keyple/core/service/spi/PluginObservationExceptionHandlerSpi.hpp"
 #include "keyple/core/service/spi/PluginObserverSpi.hpp"
 #include "keyple/core/util/cpp/LoggerFactory.hpp"
@@ -30,6 +31,7 @@ namespace core {
 namespace service {
 
 using keyple::core::service::cpp::Job;
+using keyple::core::service::cpp::MonitoringThreadPool;
 
 /**
  * Abstract class for all observable local plugin adapters.
@@ -38,7 +40,8 @@ using keyple::core::service::cpp::Job;
  */
 class KEYPLESERVICE_API AbstractObservableLocalPluginAdapter
 : public LocalPluginAdapter,
-  public ObservablePlugin {
+  public ObservablePlugin,
+  public std::enable_shared_from_this<AbstractObservableLocalPluginAdapter> {
 public:
     /**
      * Constructor.
@@ -77,9 +80,30 @@ public:
      */
     void notifyObservers(const std::shared_ptr<PluginEvent> event);
 
+    /**
+     * Makes the plugin notify its events to each observer from the provided
+     * thread pool instead of from the thread detecting them.
+     *
+     * <p>Each observer receives the events in order, but a slow observer no
+     * longer delays the reader list monitoring nor the other observers.
+     *
+     * <p>By default, the pool set with
+     * SmartCardServiceAdapter::setEventNotificationThreadPool() (if any) is
+     * used.
+     *
+     * @param threadPool The thread pool, null to notify the events
+     *        synchronously.
+     * @since 3.3.0
+     */
+    void setEventNotificationThreadPool(
+        std::shared_ptr<MonitoringThreadPool> threadPool);
+
     /**
      * {@inheritDoc}
      *
+     * <p>/!\ C++: the pending asynchronous notifications are delivered
+     * (within the monitoring stop timeout) before the observers are removed.
+     *
      * @since 2.0.0
      */
     void doUnregister() final;
@@ -135,7 +159,7 @@ private:
         ObservableLocalPluginAdapterJob(
             std::shared_ptr<PluginObserverSpi> observer,
             const std::shared_ptr<PluginEvent> event,
-            AbstractObservableLocalPluginAdapter* parent);
+            std::shared_ptr<AbstractObservableLocalPluginAdapter> parent);
 
         /**
          *
@@ -154,9 +178,9 @@ private:
         const std::shared_ptr<PluginEvent> mEvent;
 
         /**
-         *
+         * C++: keeps the plugin alive until the event has been notified.
          */
-        AbstractObservableLocalPluginAdapter* mParent;
+        std::shared_ptr<AbstractObservableLocalPluginAdapter> mParent;
     };
 
     /**
@@ -13,6 +13,9 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <future>
 #include <memory>
 #include <typeinfo>
@@ -22,12 +25,18 @@
 #include "keyple/core/service/ObservableLocalReaderAdapter.hpp"
 #include "keyple/core/service/cpp/ExecutorService.hpp"
 #include "keyple/core/service/cpp/Job.hpp"
+#include "keyple/core/service/cpp/JobFuture.hpp"
+#include "keyple/core/util/cpp/Logger.hpp"
+#include "keyple/core/util/cpp/LoggerFactory.hpp"
 
 namespace keyple {
 namespace core {
 namespace service {
 
 using keyple::core::service::cpp::ExecutorService;
+using keyple::core::service::cpp::JobFuture;
+using keyple::core::util::cpp::Logger;
+using keyple::core::util::cpp::LoggerFactory;
 
 class AbstractMonitoringJobAdapter;
 
@@ -99,21 +108,47 @@ public:
     /**
      * Invoked when deactivated. Cancel the monitoringJob if necessary.
      *
+     * <p>C++: the cancelled job is not waited for here as it may itself be
+     * blocked on the state machine (e.g. notifying its last event). Its
+     * handle is returned so that the caller can wait for it once the state
+     * machine lock is released.
+     *
+     * @return The handle of the cancelled job, null if no job was running.
      * @since 2.0.0
      */
-    void onDeactivate();
+    std::shared_ptr<JobFuture> onDeactivate();
 
     /**
      * Handle Internal Event.
      *
+     * <p>C++: the action and the next state are looked up in a constant
+     * transition table indexed by the current state and the event, shared by
+     * all the states. Nothing is formatted unless tracing is enabled.
+     *
      * @param event internal event received by reader
      * @since 2.0.0
      */
-    virtual void
-    onEvent(typename ObservableLocalReaderAdapter::InternalEvent event)
-        = 0;
+    void onEvent(typename ObservableLocalReaderAdapter::InternalEvent event);
+
+    /**
+     * Returns the number of times the provided event has been handled by
+     * this state, whether it led to a state switch or was ignored.
+     *
+     * <p>C++: wait-free.
+     *
+     * @param event The internal event.
+     * @since 3.3.0
+     */
+    long getEventCount(
+        typename ObservableLocalReaderAdapter::InternalEvent event) const;
 
 private:
+    /**
+     *
+     */
+    const std::unique_ptr<Logger> mLogger
+        = LoggerFactory::getLogger(typeid(AbstractObservableStateAdapter));
+
     /**
      * Identifier of the currentState
      */
@@ -132,12 +167,25 @@ private:
     /**
      * Result of the background job if any
      */
-    std::shared_ptr<Job> mMonitoringEvent;
+    std::shared_ptr<JobFuture> mMonitoringEvent;
 
     /**
      * Executor service used to execute AbstractMonitoringJobAdapter
      */
     std::shared_ptr<ExecutorService> mExecutorService;
+
+    /**
+     * Number of InternalEvent values, TIME_OUT being the last one.
+     */
+    static const std::size_t INTERNAL_EVENT_COUNT
+        = static_cast<std::size_t>(
+              ObservableLocalReaderAdapter::InternalEvent::TIME_OUT)
+          + 1;
+
+    /**
+     * Handled events, indexed by event
+     */
+    std::array<std::atomic<long>, INTERNAL_EVENT_COUNT> mEventCounts;
 };
 
 } /* namespace service */
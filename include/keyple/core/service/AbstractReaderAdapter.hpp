@@ -13,14 +13,18 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <typeinfo>
 #include <vector>
 
 #include "keyple/core/common/KeypleReaderExtension.hpp"
+#include "keyple/core/service/CardRequestResult.hpp"
 #include "keyple/core/service/KeypleServiceExport.hpp"
 #include "keyple/core/service/MultiSelectionProcessing.hpp"
+#include "keyple/core/service/cpp/ExecutorService.hpp"
 #include "keyple/core/util/cpp/LoggerFactory.hpp"
 #include "keypop/card/CardResponseApi.hpp"
 #include "keypop/card/CardSelectionResponseApi.hpp"
@@ -36,6 +40,7 @@ namespace core {
 namespace service {
 
 using keyple::core::common::KeypleReaderExtension;
+using keyple::core::service::cpp::ExecutorService;
 using keyple::core::util::cpp::Logger;
 using keyple::core::util::cpp::LoggerFactory;
 using keypop::card::CardResponseApi;
@@ -52,8 +57,10 @@ using keypop::reader::cpp::CardSelectorBase;
  *
  * @since 2.0.0
  */
-class KEYPLESERVICE_API AbstractReaderAdapter : virtual public CardReader,
-                                                public ProxyReaderApi {
+class KEYPLESERVICE_API AbstractReaderAdapter
+: virtual public CardReader,
+  public ProxyReaderApi,
+  public std::enable_shared_from_this<AbstractReaderAdapter> {
 public:
     /**
      * Constructor.
@@ -187,6 +194,23 @@ public:
         const ChannelControl channelControl)
         = 0;
 
+    /**
+     * Performs the actual transmission of the card request, the card-level
+     * failures being reported by the status of the result.
+     *
+     * <p>The default implementation calls processCardRequest() and converts
+     * the exceptions listed there; readers able to detect these failures
+     * without exceptions override it.
+     *
+     * @param cardRequest The card request.
+     * @param channelControl The channel control policy to apply.
+     * @return The result.
+     * @since 3.3.0
+     */
+    virtual CardRequestResult tryProcessCardRequest(
+        const std::shared_ptr<CardRequestSpi> cardRequest,
+        const ChannelControl channelControl);
+
     /**
      * {@inheritDoc}
      *
@@ -211,6 +235,102 @@ public:
         const std::shared_ptr<CardRequestSpi> cardRequest,
         const ChannelControl channelControl) final;
 
+    /**
+     * Same as transmitCardRequest() but an unexpected status word or a
+     * communication failure is reported by the status of the returned result
+     * rather than by an exception, together with the partial card response.
+     *
+     * <p>transmitCardRequest() is a wrapper calling
+     * CardRequestResult::getCardResponseOrThrow() on this result.
+     *
+     * @param cardRequest The card request.
+     * @param channelControl The channel control policy to apply.
+     * @return The result.
+     * @throw IllegalStateException If the reader is not registered.
+     * @throw IllegalArgumentException If the card request is null.
+     * @since 3.3.0
+     */
+    CardRequestResult tryTransmitCardRequest(
+        const std::shared_ptr<CardRequestSpi> cardRequest,
+        const ChannelControl channelControl);
+
+    /**
+     * Asynchronous variant of transmitCardRequest().
+     *
+     * <p>The request is queued to the I/O worker of the reader, which
+     * executes the requests of the reader one after the other in submission
+     * order. The worker is a dedicated thread, created on first use, or the
+     * card I/O thread pool of the service if one is configured (see
+     * SmartCardServiceAdapter::setCardIoThreadPool()).
+     *
+     * <p>All the transmissions of a reader, synchronous, asynchronous or made
+     * by the default selection processing of an observable reader, are
+     * serialized: a synchronous call waits for the asynchronous request in
+     * progress, if any, to complete.
+     *
+     * <p>C++: the exceptions described for transmitCardRequest() are
+     * rethrown by std::future::get(). A request still queued when the reader
+     * is unregistered is abandoned, its future then throws a std::future_error
+     * (broken promise). The queued request does not keep the reader alive: if
+     * it is released meanwhile, the future throws an IllegalStateException.
+     * The reader must be owned by a std::shared_ptr, as done by the plugins.
+     *
+     * @param cardRequest The card request.
+     * @param channelControl The channel control policy to apply.
+     * @return A valid future.
+     * @throw IllegalStateException If the reader is not registered.
+     * @throw IllegalArgumentException If the card request is null.
+     * @since 3.3.0
+     */
+    std::future<std::shared_ptr<CardResponseApi>> transmitCardRequestAsync(
+        const std::shared_ptr<CardRequestSpi> cardRequest,
+        const ChannelControl channelControl);
+
+    /**
+     * Asynchronous variant of transmitCardSelectionRequests(), executed by the
+     * I/O worker of the reader as described in transmitCardRequestAsync().
+     *
+     * <p>The selectors and requests are copied, the caller may release them.
+     *
+     * @param cardSelectors A list of CardSelector.
+     * @param cardSelectionRequests A list of selection cases.
+     * @param multiSelectionProcessing The multi selection policy.
+     * @param channelControl The channel control policy.
+     * @return A valid future.
+     * @throw IllegalStateException If the reader is not registered.
+     * @since 3.3.0
+     */
+    std::future<std::vector<std::shared_ptr<CardSelectionResponseApi>>>
+    transmitCardSelectionRequestsAsync(
+        const std::vector<std::shared_ptr<CardSelectorBase>>& cardSelectors,
+        const std::vector<std::shared_ptr<CardSelectionRequestSpi>>&
+            cardSelectionRequests,
+        const MultiSelectionProcessing multiSelectionProcessing,
+        const ChannelControl channelControl);
+
+protected:
+    /**
+     * Stops the I/O worker of the reader, if started: the running request is
+     * completed and the queued ones are abandoned.
+     *
+     * <p>Called by doUnregister(), and by the readers which must release the
+     * card channels before.
+     *
+     * @since 3.3.0
+     */
+    void shutdownIoWorker();
+
+    /**
+     * Returns the mutex serializing the transmissions of the reader, held
+     * during transmitCardRequest() and transmitCardSelectionRequests().
+     *
+     * <p>Recursive, so that the readers can also take it in their own
+     * channel operations called during a transmission.
+     *
+     * @since 3.3.0
+     */
+    std::recursive_mutex& getTransmissionMutex();
+
 private:
     /**
      *
@@ -242,6 +362,47 @@ private:
      *
      */
     uint64_t mBefore;
+
+    /**
+     * Returns the time elapsed since the previous request or response and
+     * restarts the measurement.
+     *
+     * <p>Called at each request and response whatever the log level, so that
+     * the elapsed time logged is always measured from the previous one.
+     *
+     * @return The elapsed time in milliseconds, with a 0.1 ms resolution.
+     * @since 3.3.0
+     */
+    double updateElapsedMs();
+
+    /**
+     * Executes the asynchronous requests, created on first use, guarded by
+     * mIoWorkerMutex.
+     */
+    std::shared_ptr<ExecutorService> mIoWorker;
+
+    /**
+     *
+     */
+    std::mutex mIoWorkerMutex;
+
+    /**
+     *
+     */
+    std::recursive_mutex mTransmissionMutex;
+
+    /**
+     * Returns the I/O worker, creating it if needed.
+     */
+    std::shared_ptr<ExecutorService> getIoWorker();
+
+    /**
+     * Returns the reader referenced by an asynchronous request.
+     *
+     * @throw IllegalStateException If the reader has been released.
+     */
+    static std::shared_ptr<AbstractReaderAdapter>
+    getReaderOrThrow(const std::weak_ptr<AbstractReaderAdapter>& weakReader);
 };
 
 } /* namespace service */
@@ -43,6 +43,21 @@ public:
      */
     explicit ApduResponseAdapter(const std::vector<uint8_t>& apdu);
 
+    /**
+     * Builds an APDU response from an array of bytes from the card, computes
+     * the status word.
+     *
+     * <p>C++: takes ownership of the bytes, no copy.
+     *
+     * @param apdu An array of at least 2 bytes.
+     * @param extraRoundTripCount The number of commands sent in addition to
+     *        the original one to obtain this response (GET RESPONSE, replay
+     *        with the right Le).
+     * @since 3.3.0
+     */
+    explicit ApduResponseAdapter(
+        std::vector<uint8_t>&& apdu, const int extraRoundTripCount = 0);
+
     /**
      *
      */
@@ -69,6 +84,14 @@ public:
      */
     int getStatusWord() const override;
 
+    /**
+     * Returns the number of commands sent in addition to the original one to
+     * obtain this response.
+     *
+     * @since 3.3.0
+     */
+    int getExtraRoundTripCount() const;
+
     /**
      *
      */
@@ -91,6 +114,11 @@ private:
      *
      */
     const int mStatusWord;
+
+    /**
+     *
+     */
+    const int mExtraRoundTripCount;
 };
 
 } /* namespace service */
@@ -37,8 +37,7 @@ using keyple::core::plugin::spi::AutonomousObservablePluginSpi;
  */
 class KEYPLESERVICE_API AutonomousObservableLocalPluginAdapter final
 : public AbstractObservableLocalPluginAdapter,
-  public AutonomousObservablePluginApi,
-  public std::enable_shared_from_this<AutonomousObservableLocalPluginAdapter> {
+  public AutonomousObservablePluginApi {
 public:
     /**
      * Constructor.
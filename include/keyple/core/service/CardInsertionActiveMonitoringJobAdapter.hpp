@@ -13,13 +13,16 @@
 
 #pragma once
 
-#include <atomic>
 #include <memory>
+#include <mutex>
 #include <typeinfo>
 
 #include "keyple/core/service/AbstractMonitoringJobAdapter.hpp"
 #include "keyple/core/service/KeypleServiceExport.hpp"
+#include "keyple/core/service/cpp/ExecutorService.hpp"
 #include "keyple/core/service/cpp/Job.hpp"
+#include "keyple/core/service/cpp/PollingJob.hpp"
+#include "keyple/core/service/cpp/TimerWheel.hpp"
 #include "keyple/core/util/cpp/LoggerFactory.hpp"
 #include "keypop/reader/CardReader.hpp"
 
@@ -27,10 +30,19 @@ namespace keyple {
 namespace core {
 namespace service {
 
+using keyple::core::service::cpp::ExecutorService;
+using keyple::core::service::cpp::PollingJob;
+using keyple::core::service::cpp::TimerWheel;
+
 /**
  * This monitoring job polls the CardReader::isCardPresent() method to detect a
  * card insertion or a card removal.
  *
+ * <p>C++: polls are not performed in a loop blocking a thread. Each poll is
+ * run as a short task on the executor of the reader and the next one is
+ * scheduled on a service-wide TimerWheel, so that a single timer thread paces
+ * the polling of all the non-blocking readers.
+ *
  * <p>All runtime exceptions that may occur during the monitoring process are
  * caught and notified at the application level through the
  * keypop::reader::spi::CardReaderObservationExceptionHandlerSpi mechanism.
@@ -49,12 +61,16 @@ public:
      * @param sleepDurationMillis time interval between two presence polls.
      * @param monitorInsertion if true, polls for CARD_INSERTED, else
      * CARD_REMOVED
+     * @param executorService C++: executor running the polls of the reader.
+     * @param timerWheel C++: timer pacing the polls.
      * @since 2.0.0
      */
     CardInsertionActiveMonitoringJobAdapter(
         ObservableLocalReaderAdapter* reader,
         const int64_t sleepDurationMillis,
-        const bool monitorInsertion);
+        const bool monitorInsertion,
+        std::shared_ptr<ExecutorService> executorService,
+        std::shared_ptr<TimerWheel> timerWheel);
 
     /**
      * Gets the monitoring process.
@@ -98,27 +114,31 @@ private:
     /**
      *
      */
-    std::atomic<bool> mLoop;
+    std::shared_ptr<ExecutorService> mExecutorService;
+
+    /**
+     *
+     */
+    std::shared_ptr<TimerWheel> mTimerWheel;
 
     /**
      *
      */
-    class CardInsertionActiveMonitoringJob final : public Job {
+    class CardInsertionActiveMonitoringJob final : public PollingJob {
     public:
         /**
          *
          */
-        CardInsertionActiveMonitoringJob(
-            std::shared_ptr<AbstractObservableStateAdapter> monitoringState,
+        explicit CardInsertionActiveMonitoringJob(
             CardInsertionActiveMonitoringJobAdapter* parent);
 
         /**
-         * Monitoring loop
+         * Starts the monitoring
          *
          * C++: this replaces run() override
          *
-         * <p>Polls for the presence of a card and loops until no card responds.
-         * <br> Triggers a CARD_INSERTED event and exits as soon as a
+         * <p>Polls for the presence of a card until no card responds.
+         * <br> Triggers a CARD_INSERTED event and ends as soon as a
          * communication with a card is established.
          *
          * <p>Any exceptions are notified to the application using the exception
@@ -126,17 +146,38 @@ private:
          */
         void execute() final;
 
-    private:
         /**
-         *
+         * Terminates the monitoring.
+         */
+        void stop();
+
+    protected:
+        /**
+         * Polls the card presence once.
          */
-        std::shared_ptr<AbstractObservableStateAdapter> mMonitoringState;
+        bool pollOnce() final;
 
+        /**
+         * Delay given by the polling policy of the reader.
+         */
+        long getNextPollDelay(const int pollCount) final;
+
+    private:
         /**
          *
          */
         CardInsertionActiveMonitoringJobAdapter* mParent;
     };
+
+    /**
+     * Job currently monitoring the reader, guarded by mMutex.
+     */
+    std::weak_ptr<CardInsertionActiveMonitoringJob> mMonitoringJob;
+
+    /**
+     *
+     */
+    std::mutex mMutex;
 };
 
 } /* namespace service */
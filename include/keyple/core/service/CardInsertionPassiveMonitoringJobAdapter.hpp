@@ -97,9 +97,7 @@ private:
         /**
          *
          */
-        CardInsertionPassiveMonitoringJob(
-            const std::shared_ptr<AbstractObservableStateAdapter>
-                monitoringState,
+        explicit CardInsertionPassiveMonitoringJob(
             CardInsertionPassiveMonitoringJobAdapter* parent);
 
         /**
@@ -116,12 +114,12 @@ private:
          */
         void execute() final;
 
-    private:
         /**
-         *
+         * C++: waits in the plugin until a card event occurs.
          */
-        const std::shared_ptr<AbstractObservableStateAdapter> mMonitoringState;
+        bool isBlocking() const final;
 
+    private:
         /**
          *
          */
@@ -13,14 +13,17 @@
 
 #pragma once
 
-#include <atomic>
 #include <memory>
+#include <mutex>
 #include <typeinfo>
 
 #include "keyple/core/plugin/spi/reader/observable/state/removal/WaitForCardRemovalBlockingSpi.hpp"
 #include "keyple/core/service/AbstractMonitoringJobAdapter.hpp"
 #include "keyple/core/service/KeypleServiceExport.hpp"
+#include "keyple/core/service/cpp/ExecutorService.hpp"
 #include "keyple/core/service/cpp/Job.hpp"
+#include "keyple/core/service/cpp/PollingJob.hpp"
+#include "keyple/core/service/cpp/TimerWheel.hpp"
 #include "keyple/core/util/cpp/LoggerFactory.hpp"
 
 namespace keyple {
@@ -29,6 +32,9 @@ namespace service {
 
 using keyple::core::plugin::spi::reader::observable::state::removal::
     WaitForCardRemovalBlockingSpi;
+using keyple::core::service::cpp::ExecutorService;
+using keyple::core::service::cpp::PollingJob;
+using keyple::core::service::cpp::TimerWheel;
 using keyple::core::util::cpp::LoggerFactory;
 
 /**
@@ -46,6 +52,10 @@ using keyple::core::util::cpp::LoggerFactory;
  *
  * <p>By default a delay of 100 ms is inserted between each APDU sending .
  *
+ * <p>C++: pings are not sent from a loop blocking a thread. Each ping is run
+ * as a short task on the executor of the reader and the next one is scheduled
+ * on a service-wide TimerWheel.
+ *
  * <p>All runtime exceptions that may occur during the monitoring process are
  * caught and notified at the application level through the appropriate
  * exception handler.
@@ -63,11 +73,15 @@ public:
      *
      * @param reader reference to the reader
      * @param sleepDurationMillis delay between between each APDU sending
+     * @param executorService C++: executor running the pings of the reader.
+     * @param timerWheel C++: timer pacing the pings.
      * @since 2.0.0
      */
     CardRemovalActiveMonitoringJobAdapter(
         ObservableLocalReaderAdapter* reader,
-        const int64_t sleepDurationMillis);
+        const int64_t sleepDurationMillis,
+        std::shared_ptr<ExecutorService> executorService,
+        std::shared_ptr<TimerWheel> timerWheel);
 
     /**
      * Gets the monitoring process.
@@ -106,37 +120,64 @@ private:
     /**
      *
      */
-    std::atomic<bool> mLoop;
+    std::shared_ptr<ExecutorService> mExecutorService;
+
+    /**
+     *
+     */
+    std::shared_ptr<TimerWheel> mTimerWheel;
 
     /**
      *
      */
-    class CardRemovalActiveMonitoringJob final : public Job {
+    class CardRemovalActiveMonitoringJob final : public PollingJob {
     public:
         /**
          *
          */
-        CardRemovalActiveMonitoringJob(
-            const std::shared_ptr<AbstractObservableStateAdapter>
-                monitoringState,
+        explicit CardRemovalActiveMonitoringJob(
             CardRemovalActiveMonitoringJobAdapter* parent);
 
         /**
-         *
+         * C++: this replaces run() override
          */
         void execute() final;
 
-    private:
         /**
+         * Terminates the monitoring.
          *
+         * <p>C++: no CARD_REMOVED event is notified, the state being left
+         * handles the removal itself if needed.
          */
-        const std::shared_ptr<AbstractObservableStateAdapter> mMonitoringState;
+        void stop();
 
+    protected:
+        /**
+         * Pings the card once.
+         */
+        bool pollOnce() final;
+
+        /**
+         * Delay given by the polling policy of the reader.
+         */
+        long getNextPollDelay(const int pollCount) final;
+
+    private:
         /**
          *
          */
         CardRemovalActiveMonitoringJobAdapter* mParent;
     };
+
+    /**
+     * Job currently monitoring the reader, guarded by mMutex.
+     */
+    std::weak_ptr<CardRemovalActiveMonitoringJob> mMonitoringJob;
+
+    /**
+     *
+     */
+    std::mutex mMutex;
 };
 
 } /* namespace service */
@@ -104,9 +104,7 @@ private:
         /**
          *
          */
-        CardRemovalPassiveMonitoringJob(
-            const std::shared_ptr<AbstractObservableStateAdapter>
-                monitoringState,
+        explicit CardRemovalPassiveMonitoringJob(
             CardRemovalPassiveMonitoringJobAdapter* parent);
 
         /**
@@ -114,12 +112,12 @@ private:
          */
         void execute() final;
 
-    private:
         /**
-         *
+         * C++: waits in the plugin until a card event occurs.
          */
-        const std::shared_ptr<AbstractObservableStateAdapter> mMonitoringState;
+        bool isBlocking() const final;
 
+    private:
         /**
          *
          */
@@ -0,0 +1,181 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "keyple/core/service/KeypleServiceExport.hpp"
+#include "keyple/core/util/cpp/exception/Exception.hpp"
+#include "keypop/card/CardResponseApi.hpp"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using keyple::core::util::cpp::exception::Exception;
+using keypop::card::CardResponseApi;
+
+/**
+ * Outcome of the transmission of a card request, reporting the expected
+ * card-level failures as a status instead of an exception.
+ *
+ * <p>Returned by AbstractReaderAdapter::tryTransmitCardRequest(); the
+ * throwing AbstractReaderAdapter::transmitCardRequest() is a wrapper calling
+ * getCardResponseOrThrow().
+ *
+ * @since 3.3.0
+ */
+class KEYPLESERVICE_API CardRequestResult final {
+public:
+    /**
+     * Status of a card request transmission.
+     *
+     * @since 3.3.0
+     */
+    enum class Status {
+        /**
+         * All the APDU requests were transmitted, and their status words
+         * accepted if checked.
+         */
+        SUCCESS,
+
+        /**
+         * The transmission was stopped by a status word not in the
+         * successful status words of its APDU request.
+         */
+        UNEXPECTED_STATUS_WORD,
+
+        /**
+         * The communication with the reader failed.
+         */
+        READER_COMMUNICATION_FAILURE,
+
+        /**
+         * The communication with the card failed.
+         */
+        CARD_COMMUNICATION_FAILURE
+    };
+
+    /**
+     * Creates a successful result.
+     *
+     * @param cardResponse The card response.
+     * @since 3.3.0
+     */
+    explicit CardRequestResult(
+        const std::shared_ptr<CardResponseApi> cardResponse);
+
+    /**
+     * Creates a failed result.
+     *
+     * @param status The status, other than SUCCESS.
+     * @param cardResponse The responses received before the failure.
+     * @param isCardResponseComplete True if all the APDU requests were
+     *        transmitted.
+     * @param message The message of the equivalent exception.
+     * @param cause The I/O exception reported by the reader, null if none.
+     * @since 3.3.0
+     */
+    CardRequestResult(
+        const Status status,
+        const std::shared_ptr<CardResponseApi> cardResponse,
+        const bool isCardResponseComplete,
+        const std::string& message,
+        const std::shared_ptr<Exception> cause);
+
+    /**
+     * @return The status of the transmission.
+     * @since 3.3.0
+     */
+    Status getStatus() const;
+
+    /**
+     * @return True if the status is SUCCESS.
+     * @since 3.3.0
+     */
+    bool isSuccessful() const;
+
+    /**
+     * Returns the card response, partial if the transmission failed.
+     *
+     * @return Null only if the transmission failed before any APDU could be
+     *         exchanged.
+     * @since 3.3.0
+     */
+    std::shared_ptr<CardResponseApi> getCardResponse() const;
+
+    /**
+     * @return True if all the APDU requests were transmitted.
+     * @since 3.3.0
+     */
+    bool isCardResponseComplete() const;
+
+    /**
+     * @return An empty string if the transmission succeeded.
+     * @since 3.3.0
+     */
+    const std::string& getMessage() const;
+
+    /**
+     * @return The I/O exception reported by the reader, null if none.
+     * @since 3.3.0
+     */
+    std::shared_ptr<Exception> getCause() const;
+
+    /**
+     * Returns the card response if the transmission succeeded, otherwise
+     * throws the exception the throwing API reports for this status.
+     *
+     * @return The card response.
+     * @throw ReaderBrokenCommunicationException If the communication with the
+     *        reader has failed.
+     * @throw CardBrokenCommunicationException If the communication with the
+     *        card has failed.
+     * @throw UnexpectedStatusWordException If the card returned an unexpected
+     *        status word.
+     * @since 3.3.0
+     */
+    std::shared_ptr<CardResponseApi> getCardResponseOrThrow() const;
+
+private:
+    /**
+     *
+     */
+    Status mStatus;
+
+    /**
+     *
+     */
+    std::shared_ptr<CardResponseApi> mCardResponse;
+
+    /**
+     *
+     */
+    bool mIsCardResponseComplete;
+
+    /**
+     *
+     */
+    std::string mMessage;
+
+    /**
+     *
+     */
+    std::shared_ptr<Exception> mCause;
+};
+
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
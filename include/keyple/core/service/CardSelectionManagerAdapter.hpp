@@ -23,6 +23,7 @@
 #include "keyple/core/service/KeypleServiceExport.hpp"
 #include "keyple/core/service/MultiSelectionProcessing.hpp"
 #include "keyple/core/service/ObservableLocalReaderAdapter.hpp"
+#include "keyple/core/service/ParallelCardSelectionResult.hpp"
 #include "keyple/core/service/ScheduledCardSelectionsResponseAdapter.hpp"
 #include "keyple/core/util/KeypleAssert.hpp"
 #include "keyple/core/util/cpp/Logger.hpp"
@@ -127,6 +128,36 @@ public:
     const std::shared_ptr<CardSelectionResult>
     processCardSelectionScenario(std::shared_ptr<CardReader> reader) override;
 
+    /**
+     * Processes the prepared card selection scenario on several readers
+     * concurrently.
+     *
+     * <p>The card exchanges are run by at most maxParallelism worker threads,
+     * each reader being handled by a single worker. The responses are then
+     * parsed on the calling thread, one reader after the other, so the card
+     * extensions are never invoked concurrently. If not all the worker
+     * threads can be started, the readers are shared by the ones started.
+     *
+     * <p>A failure on a reader does not interrupt the processing of the other
+     * ones, it is reported in the result of the reader. The scenario must not
+     * be modified while this method is running.
+     *
+     * <p>Unlike processCardSelectionScenario(), the responses are not kept for
+     * exportProcessedCardSelectionScenario().
+     *
+     * @param readers The readers, all different.
+     * @param maxParallelism The maximum number of readers processed at the
+     *        same time (at least 1).
+     * @return One result per reader, in the order of the provided readers.
+     * @throw IllegalArgumentException If a reader is null or provided twice,
+     *        or if maxParallelism is less than 1.
+     * @since 3.3.0
+     */
+    std::vector<std::shared_ptr<ParallelCardSelectionResult>>
+    processCardSelectionScenarioInParallel(
+        const std::vector<std::shared_ptr<CardReader>>& readers,
+        const int maxParallelism);
+
     /**
      * {@inheritDoc}
      *
@@ -238,6 +269,31 @@ private:
     const std::shared_ptr<CardSelectionResult> processCardSelectionResponses(
         const std::vector<std::shared_ptr<CardSelectionResponseApi>>&
             cardSelectionResponses);
+
+    /**
+     * Same as processCardSelectionResponses() without keeping the responses.
+     *
+     * @param cardSelectionResponses The card selection responses.
+     * @return A not null reference.
+     * @throw IllegalArgumentException If the list is null or empty.
+     */
+    const std::shared_ptr<CardSelectionResult> parseCardSelectionResponses(
+        const std::vector<std::shared_ptr<CardSelectionResponseApi>>&
+            cardSelectionResponses) const;
+
+    /**
+     * Transmits the card selection requests of the scenario to the provided
+     * reader.
+     *
+     * @param reader The reader.
+     * @return The card selection responses.
+     * @throw ReaderCommunicationException If the communication with the reader
+     *        has failed.
+     * @throw CardCommunicationException If the communication with the card
+     *        has failed.
+     */
+    std::vector<std::shared_ptr<CardSelectionResponseApi>>
+    transmitCardSelectionRequests(std::shared_ptr<CardReader> reader) const;
 };
 
 } /* namespace service */
@@ -0,0 +1,83 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#pragma once
+
+#include "keyple/core/service/KeypleServiceExport.hpp"
+#include "keyple/core/service/spi/PollingPolicySpi.hpp"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using keyple::core::service::spi::PollingPolicySpi;
+
+/**
+ * Polling policy backing off exponentially while no card is presented.
+ *
+ * <p>The card insertion polling starts at the initial delay, which is doubled
+ * every given number of polls up to the maximum delay. The card removal is
+ * polled with the delay configured by the plugin, and the insertion polling
+ * restarts from the initial delay once the card has been removed.
+ *
+ * @since 3.3.0
+ */
+class KEYPLESERVICE_API ExponentialBackoffPollingPolicy final
+: public PollingPolicySpi {
+public:
+    /**
+     * Constructor.
+     *
+     * @param initialDelayMillis The delay of the first polls (at least 1).
+     * @param maxDelayMillis The maximum delay (not less than the initial
+     *        delay).
+     * @param pollsPerStep The number of polls between two doublings of the
+     *        delay (at least 1).
+     * @throw IllegalArgumentException If an argument is out of range.
+     * @since 3.3.0
+     */
+    ExponentialBackoffPollingPolicy(
+        const long initialDelayMillis,
+        const long maxDelayMillis,
+        const int pollsPerStep);
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 3.3.0
+     */
+    long getNextPollDelay(
+        const bool monitorInsertion,
+        const int pollCount,
+        const long defaultDelayMillis) override;
+
+private:
+    /**
+     *
+     */
+    const long mInitialDelayMillis;
+
+    /**
+     *
+     */
+    const long mMaxDelayMillis;
+
+    /**
+     *
+     */
+    const int mPollsPerStep;
+};
+
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
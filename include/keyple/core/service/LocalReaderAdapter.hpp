@@ -13,17 +13,25 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "keyple/core/plugin/spi/reader/ReaderSpi.hpp"
 #include "keyple/core/service/AbstractReaderAdapter.hpp"
 #include "keyple/core/service/ApduResponseAdapter.hpp"
+#include "keyple/core/service/CardRequestResult.hpp"
 #include "keyple/core/service/CardResponseAdapter.hpp"
 #include "keyple/core/service/InternalIsoCardSelector.hpp"
 #include "keyple/core/service/KeypleServiceExport.hpp"
+#include "keyple/core/service/cpp/ApduTraceBuffer.hpp"
+#include "keyple/core/service/cpp/TransactionArena.hpp"
+#include "keyple/core/service/spi/BatchTransmitReaderSpi.hpp"
 #include "keyple/core/util/cpp/KeypleStd.hpp"
 #include "keypop/card/spi/ApduRequestSpi.hpp"
 #include "keypop/card/spi/CardSelectionRequestSpi.hpp"
@@ -37,6 +45,10 @@ namespace core {
 namespace service {
 
 using keyple::core::plugin::spi::reader::ReaderSpi;
+using keyple::core::service::cpp::ApduTraceBuffer;
+using keyple::core::service::cpp::ArenaAllocator;
+using keyple::core::service::cpp::TransactionArena;
+using keyple::core::service::spi::BatchTransmitReaderSpi;
 using keypop::card::spi::ApduRequestSpi;
 using keypop::card::spi::CardSelectionRequestSpi;
 using keypop::reader::selection::CardSelector;
@@ -128,6 +140,19 @@ public:
         const std::shared_ptr<CardRequestSpi> cardRequest,
         const ChannelControl channelControl) final;
 
+    /**
+     * {@inheritDoc}
+     *
+     * <p>The unexpected status words and the I/O failures reported by the
+     * reader SPI are turned into a status without any exception being thrown
+     * by the service.
+     *
+     * @since 3.3.0
+     */
+    CardRequestResult tryProcessCardRequest(
+        const std::shared_ptr<CardRequestSpi> cardRequest,
+        const ChannelControl channelControl) final;
+
     /**
      * {@inheritDoc}
      *
@@ -172,83 +197,55 @@ public:
     void releaseChannel() final;
 
     /**
-     * (private)<br>
-     * Local implementation of ApduRequestSpi.
+     * Enables or disables the transaction arena of this reader (disabled by
+     * default).
+     *
+     * <p>When enabled, the response objects created while processing a card
+     * request or a card selection scenario are allocated in a single memory
+     * arena instead of one heap allocation each. The arena lives as long as
+     * one of these objects and is reused by a later transaction once they
+     * have all been released. The response bytes themselves are not
+     * affected: they are moved from the reader SPI without copy.
+     *
+     * @param enabled True to enable the arena.
+     * @since 3.3.0
      */
-    class ApduRequest : public ApduRequestSpi {
-    public:
-        friend class LocalReaderAdapter;
-
-        /**
-         *
-         */
-        virtual ~ApduRequest() = default;
-
-        /**
-         *
-         */
-        std::vector<uint8_t> getApdu() const override;
-
-        /**
-         *
-         */
-        const std::vector<int>& getSuccessfulStatusWords() const override;
-
-        /**
-         *
-         */
-        const std::string& getInfo() const override;
-
-        /**
-         *
-         */
-        friend std::ostream&
-        operator<<(std::ostream& os, const ApduRequest& ar);
-
-        /**
-         *
-         */
-        friend std::ostream&
-        operator<<(std::ostream& os, const std::shared_ptr<ApduRequest> ar);
-
-        /**
-         *
-         */
-        friend std::ostream& operator<<(
-            std::ostream& os,
-            const std::vector<std::shared_ptr<ApduRequest>>& ars);
-
-    private:
-        /**
-         *
-         */
-        static const int DEFAULT_SUCCESSFUL_CODE;
-
-        /**
-         *
-         */
-        std::vector<uint8_t> mApdu;
-
-        /**
-         *
-         */
-        const std::vector<int> mSuccessfulStatusWords;
+    void setTransactionArenaEnabled(const bool enabled);
 
-        /**
-         *
-         */
-        std::string mInfo;
+    /**
+     * Returns the last APDU exchanges of this reader, oldest first.
+     *
+     * <p>Every exchange is recorded, whatever the log level, in a fixed-size
+     * ring buffer holding the command header, the status word, the byte
+     * counts and the timestamps (see ApduTraceBuffer).
+     *
+     * @return A copy of the recorded exchanges.
+     * @since 3.3.0
+     */
+    std::vector<ApduTraceBuffer::Record> getApduTrace() const;
 
-        /**
-         *
-         */
-        explicit ApduRequest(const std::vector<uint8_t>& apdu);
+    /**
+     * Logs the last APDU exchanges of this reader at warn level.
+     *
+     * <p>Called automatically when an exchange fails if enabled with
+     * setApduTraceDumpOnFailureEnabled(bool).
+     *
+     * @since 3.3.0
+     */
+    void dumpApduTrace() const;
 
-        /**
-         *
-         */
-        ApduRequest& setInfo(const std::string& info);
-    };
+    /**
+     * Enables or disables the automatic dump of the APDU trace when an
+     * exchange fails (disabled by default).
+     *
+     * <p>When enabled, every failed exchange logs the whole trace at warn
+     * level, which may be verbose with a card frequently removed during a
+     * transaction.
+     *
+     * @param enabled True to dump the trace on failure.
+     * @since 3.3.0
+     */
+    void setApduTraceDumpOnFailureEnabled(const bool enabled);
 
 protected:
     /**
@@ -274,6 +271,28 @@ private:
     static const int SW1_MASK;
     static const int SW2_MASK;
 
+    /**
+     * Successful status words of the internal commands
+     */
+    static const std::vector<int> INTERNAL_SUCCESSFUL_STATUS_WORDS;
+
+    /**
+     *
+     */
+    static const std::string GET_RESPONSE_INFO;
+
+    /**
+     * Maximum number of GET RESPONSE or replayed commands sent to complete
+     * the response to a single command
+     */
+    static const int MAX_EXTRA_ROUND_TRIPS;
+
+    /**
+     * Size of the blocks of the transaction arenas, enough for the responses
+     * of a transaction of about 20 APDUs
+     */
+    static const std::size_t TRANSACTION_ARENA_BLOCK_SIZE;
+
     /**
      *
      */
@@ -309,6 +328,99 @@ private:
      */
     std::map<const std::string, const std::string> mProtocolAssociations;
 
+    /**
+     *
+     */
+    std::atomic<bool> mTransactionArenaEnabled;
+
+    /**
+     * Arena of the transaction in progress, null if none or if disabled,
+     * guarded by mTransactionArenaMutex.
+     */
+    std::shared_ptr<TransactionArena> mTransactionArena;
+
+    /**
+     * Thread running the transaction which owns mTransactionArena, guarded
+     * by mTransactionArenaMutex.
+     */
+    std::thread::id mTransactionArenaThread;
+
+    /**
+     * Arena of the previous transaction, reused when no longer referenced,
+     * guarded by mTransactionArenaMutex.
+     */
+    std::shared_ptr<TransactionArena> mLastTransactionArena;
+
+    /**
+     *
+     */
+    std::mutex mTransactionArenaMutex;
+
+    /**
+     * Always-on record of the last APDU exchanges
+     */
+    ApduTraceBuffer mApduTrace;
+
+    /**
+     *
+     */
+    std::atomic<bool> mApduTraceDumpOnFailureEnabled;
+
+    /**
+     * Makes the responses created during its lifetime use a transaction
+     * arena, if enabled. Nested scopes share the arena of the outermost one.
+     *
+     * <p>The arena is not thread-safe: it is only used by the thread which
+     * has installed it. A transaction started meanwhile by another thread
+     * allocates its responses on the heap.
+     */
+    class TransactionArenaScope final {
+    public:
+        /**
+         *
+         */
+        explicit TransactionArenaScope(LocalReaderAdapter* reader);
+
+        /**
+         *
+         */
+        ~TransactionArenaScope();
+
+    private:
+        /**
+         *
+         */
+        LocalReaderAdapter* mReader;
+
+        /**
+         * True if this scope has installed the arena
+         */
+        bool mOwner;
+    };
+
+    /**
+     * Gets the arena of the transaction in progress if it is owned by the
+     * calling thread, null otherwise.
+     */
+    std::shared_ptr<TransactionArena> getTransactionArena();
+
+    /**
+     * Creates a response object in the arena of the transaction in progress
+     * if any, on the heap otherwise.
+     */
+    template <typename T, typename... Args>
+    std::shared_ptr<T>
+    makeResponse(Args&&... args)
+    {
+        const std::shared_ptr<TransactionArena> arena = getTransactionArena();
+        if (arena != nullptr) {
+            return std::allocate_shared<T>(
+                ArenaAllocator<T>(arena), std::forward<Args>(args)...);
+        }
+
+        return std::make_shared<T>(std::forward<Args>(args)...);
+    }
+
     /**
      * This POJO contains the card selection status.
      */
@@ -480,30 +592,142 @@ private:
     processApduRequest(const std::shared_ptr<ApduRequestSpi> apduRequest);
 
     /**
-     * Transmits a CardRequestSpi and returns a CardResponseAdapter.
+     * Transmits an APDU command and receives the ApduResponseAdapter, the
+     * 61XX, 6CXX and case 4 status words being handled here.
      *
-     * @param cardRequest The card request to transmit.
+     * <p>C++: the command is passed and the response moved without copy, the
+     * internal commands (selection, GET RESPONSE) do not go through an
+     * ApduRequestSpi.
+     *
+     * <p>The response is completed iteratively: the data of successive 61XX
+     * responses are concatenated in a single buffer, followed by the last
+     * response. At most MAX_EXTRA_ROUND_TRIPS commands are added to the
+     * initial one, the last response received is then returned as is. The
+     * number of added commands is reported by
+     * ApduResponseAdapter::getExtraRoundTripCount().
+     *
+     * @param apdu The APDU command, its Le is updated in place upon a 6CXX
+     *        status word before being replayed.
+     * @param successfulStatusWords The successful status words of the
+     *        command.
+     * @param info The information about the command, for logging purposes.
      * @return A not null reference.
-     * @throw ReaderBrokenCommunicationException If the communication with the
-     * reader has failed.
-     * @throw CardBrokenCommunicationException If the communication with the
-     * card has failed.
-     * @throw UnexpectedStatusWordException If status word verification is
-     * enabled in the card request and the card returned an unexpected code.
+     * @throw ReaderIOException if the communication with the reader has failed.
+     * @throw CardIOException if the communication with the card has failed.
+     */
+    std::shared_ptr<ApduResponseAdapter> processApdu(
+        std::vector<uint8_t>& apdu,
+        const std::vector<int>& successfulStatusWords,
+        const std::string& info);
+
+    /**
+     * Completes the first response received to an APDU command, as described
+     * in processApdu(), and receives the ApduResponseAdapter.
+     *
+     * @param apdu The APDU command, its Le is updated in place upon a 6CXX
+     *        status word before being replayed.
+     * @param response The first response received to the command.
+     * @param successfulStatusWords The successful status words of the
+     *        command.
+     * @param info The information about the command, for logging purposes.
+     * @return A not null reference.
+     * @throw ReaderIOException if the communication with the reader has failed.
+     * @throw CardIOException if the communication with the card has failed.
      */
-    std::shared_ptr<CardResponseAdapter>
-    processCardRequest(const std::shared_ptr<CardRequestSpi> cardRequest);
+    std::shared_ptr<ApduResponseAdapter> completeApduResponse(
+        std::vector<uint8_t>& apdu,
+        std::vector<uint8_t>&& response,
+        const std::vector<int>& successfulStatusWords,
+        const std::string& info);
 
     /**
+     * Transmits a single APDU command to the reader, records the exchange in
+     * the APDU trace and logs it.
      *
+     * @param command The APDU command.
+     * @param info The information about the command, for logging purposes.
+     * @return The response of the card.
+     * @throw ReaderIOException if the communication with the reader has failed.
+     * @throw CardIOException if the communication with the card has failed.
+     */
+    std::vector<uint8_t> exchangeApdu(
+        const std::vector<uint8_t>& command, const std::string& info);
+
+    /**
+     * Transmits several APDU commands to the reader in one exchange, records
+     * them in the APDU trace and logs the exchange.
+     *
+     * @param batchReader The reader SPI, seen as a BatchTransmitReaderSpi.
+     * @param commands The APDU commands, at least 2.
+     * @return The responses of the card, at least 1.
+     * @throw ReaderIOException if the communication with the reader has failed
+     *        or if the reader returned no response or more responses than
+     *        commands.
+     * @throw CardIOException if the communication with the card has failed.
+     */
+    std::vector<std::vector<uint8_t>> exchangeApdus(
+        const std::shared_ptr<BatchTransmitReaderSpi> batchReader,
+        const std::vector<std::vector<uint8_t>>& commands);
+
+    /**
+     * Transmits a CardRequestSpi and returns its result, the card response
+     * being a CardResponseAdapter.
+     *
+     * <p>The card-level failures are reported by the status of the result:
+     * UNEXPECTED_STATUS_WORD if status word verification is enabled in the
+     * card request and the card returned an unexpected code,
+     * READER_COMMUNICATION_FAILURE or CARD_COMMUNICATION_FAILURE if the
+     * communication has failed (the channels are then closed).
+     *
+     * @param cardRequest The card request to transmit.
+     * @return The result, with a not null card response.
      */
-    friend std::ostream& operator<<(std::ostream& os, ApduRequest& ar);
+    CardRequestResult
+    tryProcessCardRequest(const std::shared_ptr<CardRequestSpi> cardRequest);
 
     /**
+     * Transmits a sequence of the APDU requests of a card request in one
+     * exchange and adds their responses to the provided list.
+     *
+     * <p>The sequence starts at the provided index and ends with the first
+     * case 4 command, since its response may have to be completed by a GET
+     * RESPONSE before any other command is sent. The responses are then
+     * completed and evaluated one by one as if they had been transmitted
+     * separately.
      *
+     * @param batchReader The reader SPI, seen as a BatchTransmitReaderSpi.
+     * @param cardRequest The card request.
+     * @param index The index of the first APDU request to transmit.
+     * @param apduResponses The responses received so far (in/out).
+     * @param isStatusWordUnexpected Set to true if the processing stopped on
+     *        an unexpected status word (out).
+     * @return The number of APDU requests processed (at least 1).
+     * @throw ReaderIOException if the communication with the reader has failed.
+     * @throw CardIOException if the communication with the card has failed.
      */
-    friend std::ostream&
-    operator<<(std::ostream& os, const std::shared_ptr<ApduRequest> ar);
+    std::size_t processApduRequestBatch(
+        const std::shared_ptr<BatchTransmitReaderSpi> batchReader,
+        const std::shared_ptr<CardRequestSpi> cardRequest,
+        const std::size_t index,
+        std::vector<std::shared_ptr<ApduResponseApi>>& apduResponses,
+        bool& isStatusWordUnexpected);
+
+    /**
+     * Adds the response to an APDU request of a card request to the provided
+     * list and checks its status word.
+     *
+     * @param cardRequest The card request.
+     * @param apduRequest The APDU request.
+     * @param apduResponse The response to the APDU request.
+     * @param apduResponses The responses received so far (in/out).
+     * @return True if status word verification is enabled in the card request
+     *         and the card returned an unexpected code.
+     */
+    bool addApduResponse(
+        const std::shared_ptr<CardRequestSpi> cardRequest,
+        const std::shared_ptr<ApduRequestSpi> apduRequest,
+        const std::shared_ptr<ApduResponseAdapter> apduResponse,
+        std::vector<std::shared_ptr<ApduResponseApi>>& apduResponses);
 };
 
 } /* namespace service */
@@ -13,14 +13,18 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
+#include <thread>
 #include <typeinfo>
 #include <vector>
 
 #include "keyple/core/plugin/spi/ObservablePluginSpi.hpp"
 #include "keyple/core/service/AbstractObservableLocalPluginAdapter.hpp"
 #include "keyple/core/service/KeypleServiceExport.hpp"
+#include "keyple/core/service/cpp/CancellationToken.hpp"
+#include "keyple/core/service/cpp/CountDownLatch.hpp"
 #include "keyple/core/util/cpp/Thread.hpp"
 #include "keyple/core/util/cpp/exception/Exception.hpp"
 #include "keypop/reader/CardReader.hpp"
@@ -30,6 +34,8 @@ namespace core {
 namespace service {
 
 using keyple::core::plugin::spi::ObservablePluginSpi;
+using keyple::core::service::cpp::CancellationToken;
+using keyple::core::service::cpp::CountDownLatch;
 using keyple::core::util::cpp::Thread;
 using keyple::core::util::cpp::exception::Exception;
 using keypop::reader::CardReader;
@@ -147,17 +153,28 @@ private:
         /**
          *
          */
-        bool mRunning;
+        std::atomic<bool> mRunning;
 
         /**
-         *
+         * Released once the thread has entered its monitoring loop.
          */
-        bool mStarted;
+        CountDownLatch mStarted;
 
         /**
-         *
+         * Released when the thread exits, whatever the reason.
+         */
+        CountDownLatch mTerminated;
+
+        /**
+         * Id of the monitoring thread, set before mStarted is released.
          */
-        bool mTerminated;
+        std::thread::id mThreadId;
+
+        /**
+         * Cancelled by end() to cut short the wait between two monitoring
+         * cycles.
+         */
+        CancellationToken mCancellationToken;
 
         /**
          *
@@ -218,6 +235,12 @@ private:
      */
     std::shared_ptr<ObservablePluginSpi> mObservablePluginSpi;
 
+    /**
+     * Ends the monitoring thread (if any) and blocks until it has exited,
+     * unless called from the monitoring thread itself.
+     */
+    void stopMonitoringThread();
+
     /**
      * Local thread to monitoring readers presence
      */
@@ -13,8 +13,12 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -30,6 +34,9 @@
 #include "keyple/core/service/MonitoringState.hpp"
 #include "keyple/core/service/ObservationManagerAdapter.hpp"
 #include "keyple/core/service/cpp/Job.hpp"
+#include "keyple/core/service/cpp/LatencyHistogram.hpp"
+#include "keyple/core/service/cpp/MonitoringThreadPool.hpp"
+#include "keyple/core/service/spi/PollingPolicySpi.hpp"
 #include "keypop/reader/CardReaderEvent.hpp"
 #include "keypop/reader/ObservableCardReader.hpp"
 #include "keypop/reader/spi/CardReaderObservationExceptionHandlerSpi.hpp"
@@ -55,6 +62,9 @@ using keyple::core::plugin::spi::reader::observable::state::removal::
 using keyple::core::plugin::spi::reader::observable::state::removal::
     WaitForCardRemovalAutonomousSpi;
 using keyple::core::service::cpp::Job;
+using keyple::core::service::cpp::LatencyHistogram;
+using keyple::core::service::cpp::MonitoringThreadPool;
+using keyple::core::service::spi::PollingPolicySpi;
 using keypop::reader::CardReaderEvent;
 using keypop::reader::ObservableCardReader;
 using keypop::reader::spi::CardReaderObservationExceptionHandlerSpi;
@@ -76,8 +86,7 @@ class KEYPLESERVICE_API ObservableLocalReaderAdapter
   public CardInsertionWaiterAsynchronousApi,
   public CardRemovalWaiterAsynchronousApi,
   public WaitForCardInsertionAutonomousReaderApi,
-  public WaitForCardRemovalAutonomousReaderApi,
-  public std::enable_shared_from_this<ObservableLocalReaderAdapter> {
+  public WaitForCardRemovalAutonomousReaderApi {
 public:
     /**
      *
@@ -133,6 +142,54 @@ public:
         TIME_OUT
     };
 
+    /**
+     * Stages of the processing of an inserted card, from its detection to the
+     * notification of the resulting event, timed by the reader.
+     *
+     * @since 3.3.0
+     */
+    enum class LatencyStage {
+        /**
+         * From the detection of the card by the monitoring job or the plugin
+         * to the start of processCardInserted() (event queuing and state
+         * machine wake-up).
+         *
+         * @since 3.3.0
+         */
+        CARD_DETECTION,
+
+        /**
+         * Transmission of the card selection scenario.
+         *
+         * @since 3.3.0
+         */
+        CARD_SELECTION,
+
+        /**
+         * Creation of the event from the selection responses.
+         *
+         * @since 3.3.0
+         */
+        EVENT_CREATION,
+
+        /**
+         * Delivery of the event to the observers (synchronous observers are
+         * called, the others have the event queued on their executor).
+         *
+         * @since 3.3.0
+         */
+        EVENT_NOTIFICATION,
+
+        /**
+         * From the detection of the card to the delivery of the resulting
+         * CARD_INSERTED or CARD_MATCHED event to the last observer (by its
+         * notification executor, if any).
+         *
+         * @since 3.3.0
+         */
+        TAP_TO_EVENT
+    };
+
     /**
      * Creates an instance of ObservableLocalReaderAdapter.
      *
@@ -182,6 +239,121 @@ public:
      */
     MonitoringState getCurrentMonitoringState() const;
 
+    /**
+     * Returns the number of internal events currently waiting to be
+     * processed by the state machine.
+     *
+     * @since 3.3.0
+     */
+    int getEventQueueDepth() const;
+
+    /**
+     * Returns the highest number of internal events that have been waiting
+     * at the same time.
+     *
+     * @since 3.3.0
+     */
+    int getMaxEventQueueDepth() const;
+
+    /**
+     * Returns the number of card insertions dropped because the card was
+     * removed before they could be processed.
+     *
+     * @since 3.3.0
+     */
+    long getCoalescedEventCount() const;
+
+    /**
+     * Returns the number of times the provided internal event has been
+     * processed while the state machine was in the provided state.
+     *
+     * @param state The monitoring state.
+     * @param event The internal event.
+     * @since 3.3.0
+     */
+    long getTransitionCount(
+        const MonitoringState state, const InternalEvent event) const;
+
+    /**
+     * Returns the total time spent by the state machine in the provided
+     * state, current visit included.
+     *
+     * @param state The monitoring state.
+     * @return A duration in milliseconds.
+     * @since 3.3.0
+     */
+    long getTimeInState(const MonitoringState state) const;
+
+    /**
+     * Sets the maximum time the application may take to process a card, from
+     * the notification of the card event to the call to
+     * finalizeCardProcessing().
+     *
+     * <p>Once this delay has elapsed, the channels are closed and the reader
+     * proceeds as if the processing had been finalized, so that a hung
+     * application does not prevent the next cards from being detected.
+     *
+     * @param timeoutMillis The delay in milliseconds, 0 (default) to wait
+     *        without deadline.
+     * @throw IllegalArgumentException If the delay is negative.
+     * @since 3.3.0
+     */
+    void setCardProcessingTimeout(const long timeoutMillis);
+
+    /**
+     * Returns the maximum time the application may take to process a card.
+     *
+     * @return A delay in milliseconds, 0 if there is no deadline.
+     * @since 3.3.0
+     */
+    long getCardProcessingTimeout() const;
+
+    /**
+     * Returns the number of card processings which have not been finalized
+     * before the card processing timeout.
+     *
+     * @since 3.3.0
+     */
+    long getMissedProcessingDeadlineCount() const;
+
+    /**
+     * Sets the policy deciding the delay between two card presence polls,
+     * when the card insertion or removal is monitored actively.
+     *
+     * <p>The policy applies from the next poll on; it has no effect on the
+     * readers whose plugin notifies the card insertion and removal itself.
+     *
+     * @param pollingPolicy The policy, null to poll at the fixed delay
+     *        configured by the plugin.
+     * @since 3.3.0
+     */
+    void setPollingPolicy(std::shared_ptr<PollingPolicySpi> pollingPolicy);
+
+    /**
+     * Returns the delay to wait before the next card presence poll.
+     *
+     * @param monitorInsertion True while waiting for a card insertion.
+     * @param pollCount The number of polls already performed.
+     * @param defaultDelayMillis The delay configured by the plugin.
+     * @return A delay in milliseconds, at least 1.
+     * @since 3.3.0
+     */
+    long getNextPollDelay(
+        const bool monitorInsertion,
+        const int pollCount,
+        const long defaultDelayMillis) const;
+
+    /**
+     * This method is invoked when the card processing timeout elapses before
+     * the application has called finalizeCardProcessing().
+     *
+     * <p>It records the missed deadline and closes the channels; the card
+     * removal sequence is then run by the state machine.
+     *
+     * @since 3.3.0
+     */
+    void processCardProcessingTimeout();
+
     /**
      * Sends a neutral APDU to the card to check its presence. The status of the
      * response is not verified as long as the mere fact that the card responds
@@ -190,11 +362,75 @@ public:
      * <p>This method has to be called regularly until the card no longer
      * respond.
      *
+     * <p>C++: the probe APDU can be changed, or replaced by a call to
+     * ReaderSpi::checkCardPresence(), with setCardPresenceProbeApdu(). The
+     * duration of each probe is recorded, failed ones included.
+     *
      * @return True if the card still responds, false if not
      * @since 2.0.0
      */
     bool isCardPresentPing();
 
+    /**
+     * Sets the APDU sent by isCardPresentPing() to check the card presence.
+     *
+     * <p>This is a configuration of the reader, to be set while the card
+     * detection is stopped: the monitoring jobs read it without locking.
+     *
+     * @param apdu The probe APDU, empty to rely on
+     *        ReaderSpi::checkCardPresence() instead (no APDU exchanged and no
+     *        exception raised when the card is gone, if the plugin supports
+     *        it).
+     * @throw IllegalStateException If the card detection is started.
+     * @since 3.3.0
+     */
+    void setCardPresenceProbeApdu(const std::vector<uint8_t>& apdu);
+
+    /**
+     * Returns the number of card presence probes performed.
+     *
+     * @since 3.3.0
+     */
+    long getCardPresenceProbeCount() const;
+
+    /**
+     * Returns the duration of the last card presence probe.
+     *
+     * @return A duration in microseconds, 0 if no probe has been performed.
+     * @since 3.3.0
+     */
+    long getLastCardPresenceProbeLatency() const;
+
+    /**
+     * Returns the longest duration of a card presence probe.
+     *
+     * @return A duration in microseconds, 0 if no probe has been performed.
+     * @since 3.3.0
+     */
+    long getMaxCardPresenceProbeLatency() const;
+
+    /**
+     * Records the detection of a card, origin of the tap-to-event latency of
+     * the next processCardInserted().
+     *
+     * <p>Invoked by the card insertion monitoring jobs and by
+     * onCardInserted(). If a card is processed without having been recorded,
+     * its detection is considered to be the start of its processing.
+     *
+     * @since 3.3.0
+     */
+    void recordCardDetection();
+
+    /**
+     * Returns the latency histogram of the provided stage.
+     *
+     * @param stage The processing stage.
+     * @return A reference valid as long as the reader, the values are in
+     *         microseconds.
+     * @since 3.3.0
+     */
+    const LatencyHistogram& getLatencyHistogram(const LatencyStage stage) const;
+
     /**
      * This method is invoked by the card insertion monitoring process when a
      * card is inserted.
@@ -216,6 +452,9 @@ public:
      * be present in the card selection scenario are embedded into the
      * CardReaderEvent as a list of CardSelectionResponseApi.
      *
+     * <p>C++: the detection, selection and event creation stages are timed,
+     * see getLatencyHistogram().
+     *
      * @return Null if the card has been rejected by the card selection
      * scenario.
      * @since 2.0.0
@@ -241,6 +480,18 @@ public:
      */
     void switchState(MonitoringState stateId);
 
+    /**
+     * Queues an internal event for the state machine.
+     *
+     * <p>The event is processed against the state current at the time it is
+     * dequeued, so an event raised by a monitoring job which has meanwhile
+     * been stopped cannot act on a state which is no longer current.
+     *
+     * @param event The internal event.
+     * @since 3.3.0
+     */
+    void onEvent(const InternalEvent event);
+
     /**
      * Notifies all registered observers with the provided CardReaderEvent.
      *
@@ -319,6 +570,25 @@ public:
      */
     void clearObservers() override;
 
+    /**
+     * Makes the reader notify its events to each observer from the provided
+     * thread pool instead of from the monitoring thread.
+     *
+     * <p>Each observer receives the events in order, but a long event
+     * processing (e.g. a card transaction) no longer delays the card removal
+     * detection nor the other observers.
+     *
+     * <p>By default, the pool set with
+     * SmartCardServiceAdapter::setEventNotificationThreadPool() (if any) is
+     * used.
+     *
+     * @param threadPool The thread pool, null to notify the events
+     *        synchronously.
+     * @since 3.3.0
+     */
+    void setEventNotificationThreadPool(
+        std::shared_ptr<MonitoringThreadPool> threadPool);
+
     /**
      * {@inheritDoc}
      *
@@ -329,6 +599,11 @@ public:
     /**
      * {@inheritDoc}
      *
+     * <p>C++: the STOP_DETECT event is queued. When another thread is
+     * processing an event of this reader (e.g. the monitoring job notifying a
+     * card insertion), this method returns before the detection is stopped;
+     * the transition is applied by that thread right after.
+     *
      * @since 2.0.0
      */
     void stopCardDetection() override;
@@ -336,6 +611,11 @@ public:
     /**
      * {@inheritDoc}
      *
+     * <p>C++: the CARD_PROCESSED event is queued. When another thread is
+     * processing an event of this reader, this method returns before the
+     * removal sequence is started; the transition is applied by that thread
+     * right after.
+     *
      * @since 2.0.0
      */
     void finalizeCardProcessing() override;
@@ -364,6 +644,21 @@ public:
     void onCardRemoved() override;
 
 private:
+    /**
+     * Delivery of the event resulting from a card tap, the last observer
+     * delivered records the tap-to-event latency.
+     */
+    struct TapDelivery {
+        TapDelivery(const long long tapAtMicros, const int observerCount)
+        : mTapAtMicros(tapAtMicros)
+        , mPendingObserverCount(observerCount)
+        {
+        }
+
+        const long long mTapAtMicros;
+        std::atomic<int> mPendingObserverCount;
+    };
+
     /**
      *
      */
@@ -375,7 +670,8 @@ private:
         ObservableLocalReaderAdapterJob(
             std::shared_ptr<CardReaderObserverSpi> observer,
             const std::shared_ptr<CardReaderEvent> event,
-            ObservableLocalReaderAdapter* parent);
+            std::shared_ptr<ObservableLocalReaderAdapter> parent,
+            std::shared_ptr<TapDelivery> tapDelivery);
 
         /**
          * C++: this replaces run() override
@@ -394,9 +690,14 @@ private:
         const std::shared_ptr<CardReaderEvent> mEvent;
 
         /**
-         *
+         * C++: keeps the reader alive until the event has been notified.
+         */
+        const std::shared_ptr<ObservableLocalReaderAdapter> mParent;
+
+        /**
+         * Null if the event does not result from a card tap.
          */
-        ObservableLocalReaderAdapter* mParent;
+        const std::shared_ptr<TapDelivery> mTapDelivery;
     };
 
     /**
@@ -410,6 +711,12 @@ private:
      */
     static const std::vector<uint8_t> APDU_PING_CARD_PRESENCE;
 
+    /**
+     * Shortest delay between two card presence polls, a shorter delay would
+     * turn the polling into a busy loop
+     */
+    static const long MIN_POLL_DELAY_MILLIS;
+
     /**
      *
      */
@@ -448,6 +755,110 @@ private:
      */
     bool mIsCardRemovedEventNotificationEnabled;
 
+    /**
+     *
+     */
+    std::atomic<long> mCardProcessingTimeoutMillis;
+
+    /**
+     *
+     */
+    std::atomic<long> mMissedProcessingDeadlineCount;
+
+    /**
+     * Guarded by mPollingPolicyMutex.
+     */
+    std::shared_ptr<PollingPolicySpi> mPollingPolicy;
+
+    /**
+     *
+     */
+    mutable std::mutex mPollingPolicyMutex;
+
+    /**
+     * Empty to use ReaderSpi::checkCardPresence(), only changed while the
+     * card detection is stopped.
+     */
+    std::vector<uint8_t> mCardPresenceProbeApdu;
+
+    /**
+     *
+     */
+    std::atomic<long> mCardPresenceProbeCount;
+
+    /**
+     *
+     */
+    std::atomic<long> mLastCardPresenceProbeLatencyMicros;
+
+    /**
+     *
+     */
+    std::atomic<long> mMaxCardPresenceProbeLatencyMicros;
+
+    /**
+     * Records the duration of a card presence probe.
+     */
+    void recordCardPresenceProbeLatency(const long latencyMicros);
+
+    /**
+     * Number of LatencyStage values.
+     */
+    static const std::size_t LATENCY_STAGE_COUNT = 5;
+
+    /**
+     * Indexed by LatencyStage.
+     */
+    std::array<LatencyHistogram, LATENCY_STAGE_COUNT> mLatencyHistograms;
+
+    /**
+     * Steady clock time in microseconds of the last recorded card detection,
+     * 0 once consumed by processCardInserted().
+     */
+    std::atomic<long long> mCardDetectedAtMicros;
+
+    /**
+     * Event resulting from the last card tap, until notified, guarded by
+     * mTapMutex.
+     */
+    std::shared_ptr<CardReaderEvent> mTapEvent;
+
+    /**
+     * Detection time of the card of mTapEvent, guarded by mTapMutex.
+     */
+    long long mTapAtMicros;
+
+    /**
+     *
+     */
+    std::mutex mTapMutex;
+
+    /**
+     * Records the tap-to-event latency once the event resulting from a card
+     * tap has been delivered to all the observers.
+     *
+     * @param tapDelivery The delivery, null if the event does not result
+     *        from a card tap.
+     */
+    void onEventDelivered(const std::shared_ptr<TapDelivery>& tapDelivery);
+
+    /**
+     * Records a duration in the histogram of the provided stage.
+     */
+    void recordLatency(const LatencyStage stage, const long long latencyMicros);
+
+    /**
+     * Returns the current time of the steady clock in microseconds.
+     */
+    static long long steadyClockMicros();
+
+    /**
+     * Processes the card selection scenario (if any) for an inserted card.
+     *
+     * @return The event to notify, null if none.
+     */
+    std::shared_ptr<CardReaderEvent> processCardSelectionScenario();
+
     /**
      * Notifies a single observer of an event.
      *
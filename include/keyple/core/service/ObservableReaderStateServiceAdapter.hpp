@@ -13,7 +13,10 @@
 
 #pragma once
 
-#include <map>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <typeinfo>
@@ -22,16 +25,20 @@
 #include "keyple/core/service/KeypleServiceExport.hpp"
 #include "keyple/core/service/ObservableLocalReaderAdapter.hpp"
 #include "keyple/core/service/cpp/ExecutorService.hpp"
+#include "keyple/core/service/cpp/TimerWheel.hpp"
 #include "keyple/core/util/cpp/Logger.hpp"
 #include "keyple/core/util/cpp/LoggerFactory.hpp"
+#include "keyple/core/util/cpp/exception/Exception.hpp"
 
 namespace keyple {
 namespace core {
 namespace service {
 
 using keyple::core::service::cpp::ExecutorService;
+using keyple::core::service::cpp::TimerWheel;
 using keyple::core::util::cpp::Logger;
 using keyple::core::util::cpp::LoggerFactory;
+using keyple::core::util::cpp::exception::Exception;
 
 using InternalEvent = ObservableLocalReaderAdapter::InternalEvent;
 
@@ -41,7 +48,8 @@ using InternalEvent = ObservableLocalReaderAdapter::InternalEvent;
  *
  * @since 2.0.0
  */
-class KEYPLESERVICE_API ObservableReaderStateServiceAdapter final {
+class KEYPLESERVICE_API ObservableReaderStateServiceAdapter final
+: public std::enable_shared_from_this<ObservableReaderStateServiceAdapter> {
 public:
     /**
      * Initializes the states according to the interfaces implemented by the
@@ -60,6 +68,21 @@ public:
      * this method to inform the reader of external event like a tag discovered
      * or a card inserted
      *
+     * <p>C++: the events are queued and processed one at a time, in order, by
+     * the calling thread which finds the queue idle. A call made while
+     * another event is being processed (by another thread, or re-entrantly
+     * from the state machine) returns as soon as the event is queued.
+     *
+     * <p>A CARD_INSERTED still pending when a CARD_REMOVED is queued is
+     * dropped (card bouncing on the antenna): no selection is attempted and
+     * the removal restarts the detection.
+     *
+     * <p>An Exception raised while processing an event is notified to the
+     * observation exception handler of the reader and does not propagate to
+     * the caller, the remaining events being processed anyway. Any other
+     * exception (e.g. a std::exception) propagates, the remaining events
+     * being left to the next call.
+     *
      * @param event internal event
      * @since 2.0.0
      */
@@ -69,6 +92,12 @@ public:
      * Thread safe method to switch the state of this reader should only be
      * invoked by this reader or its state
      *
+     * <p>C++: entering WAIT_FOR_CARD_PROCESSING arms the card processing
+     * timeout of the reader (if any) on the shared timer wheel, leaving it
+     * disarms it. TIME_OUT is processed on a lane of its own, out of the
+     * ordering of the monitoring jobs, a blocking card removal job being
+     * stopped by the resulting state switch.
+     *
      * @param stateId next state to onActivate
      * @since 2.0.0
      */
@@ -77,6 +106,8 @@ public:
     /**
      * Get reader current state
      *
+     * <p>C++: wait-free, does not take the state lock.
+     *
      * @return reader current state
      * @since 2.0.0
      */
@@ -85,17 +116,73 @@ public:
     /**
      * Get the reader current monitoring state
      *
+     * <p>C++: wait-free, does not take the state lock.
+     *
      * @return current monitoring state
      * @since 2.0.0
      */
     MonitoringState getCurrentMonitoringState();
 
+    /**
+     * Returns the number of events currently waiting to be processed.
+     *
+     * @since 3.3.0
+     */
+    int getEventQueueDepth();
+
+    /**
+     * Returns the highest number of events that have been waiting at the same
+     * time since the creation of the reader.
+     *
+     * @since 3.3.0
+     */
+    int getMaxEventQueueDepth();
+
+    /**
+     * Returns the number of CARD_INSERTED events dropped because the card was
+     * removed before they could be processed.
+     *
+     * @since 3.3.0
+     */
+    long getCoalescedEventCount();
+
+    /**
+     * Returns the number of times the provided event has been processed
+     * while the state machine was in the provided state, whether it led to a
+     * state switch or was ignored.
+     *
+     * <p>C++: wait-free.
+     *
+     * @param state The state.
+     * @param event The event.
+     * @since 3.3.0
+     */
+    long getTransitionCount(
+        const MonitoringState state, const InternalEvent event) const;
+
+    /**
+     * Returns the total time spent in the provided state, current visit
+     * included.
+     *
+     * <p>C++: takes a lock held only while the state times are updated, never
+     * while a state is being switched.
+     *
+     * @param state The state.
+     * @return A duration in milliseconds.
+     * @since 3.3.0
+     */
+    long getTimeInState(const MonitoringState state) const;
+
     /**
      * Shuts down the ExecutorService of this reader.
      *
      * <p>This method should be invoked when the reader monitoring ends in order
      * to stop any remaining threads.
      *
+     * <p>C++: the running monitoring job (if any) is asked to exit and waited
+     * for at most SmartCardServiceAdapter::getMonitoringStopTimeout(). The
+     * card processing timeout (if armed) is disarmed.
+     *
      * @since 2.0.0
      */
     void shutdown();
@@ -118,26 +205,135 @@ private:
     std::shared_ptr<ObservableReaderSpi> mReaderSpi;
 
     /**
-     * Executor service to provide a unique thread used by the various
-     * monitoring jobs
+     * Executor service running the various monitoring jobs one at a time,
+     * on a dedicated thread or on the shared monitoring thread pool
      */
     std::shared_ptr<ExecutorService> mExecutorService;
 
     /**
-     * Map of all instantiated states possible
+     * Service-wide timer wheel
+     */
+    std::shared_ptr<TimerWheel> mTimerWheel;
+
+    /**
+     * Pending card processing timeout (if any), guarded by mMutex
+     */
+    std::shared_ptr<TimerWheel::Timeout> mCardProcessingTimeout;
+
+    /**
+     * Executor service processing the card processing timeouts, created on
+     * first use, guarded by mMutex
+     */
+    std::shared_ptr<ExecutorService> mCardProcessingTimeoutExecutorService;
+
+    /**
+     * Incremented at each state switch, a TIME_OUT posted for an earlier
+     * visit of WAIT_FOR_CARD_PROCESSING is dropped
+     */
+    std::atomic<long> mCardProcessingTimeoutId;
+
+    /**
+     * Delay between two polls of the readers which do not provide it,
+     * adjusted by the polling policy of the reader (if any).
+     */
+    static const int DEFAULT_MONITORING_SLEEP_DURATION_MILLIS;
+
+    /**
+     * Number of MonitoringState values, WAIT_FOR_CARD_REMOVAL being the last
+     * one.
+     */
+    static const std::size_t MONITORING_STATE_COUNT
+        = static_cast<std::size_t>(MonitoringState::WAIT_FOR_CARD_REMOVAL) + 1;
+
+    /**
+     * All instantiated states possible, indexed by stateIndex(), never
+     * modified after construction
      */
-    std::map<MonitoringState, std::shared_ptr<AbstractObservableStateAdapter>>
+    std::array<
+        std::shared_ptr<AbstractObservableStateAdapter>,
+        MONITORING_STATE_COUNT>
         mStates;
 
     /**
-     * Current currentState of the Observable Reader
+     * Current currentState of the Observable Reader, guarded by mMutex
      */
     std::shared_ptr<AbstractObservableStateAdapter> mCurrentState;
 
+    /**
+     * Published once mCurrentState is updated, for lock-free reads
+     */
+    std::atomic<MonitoringState> mCurrentMonitoringState;
+
+    /**
+     * Time spent in the completed visits of each state, indexed by
+     * stateIndex(), guarded by mStateTimeMutex.
+     */
+    std::array<long long, MONITORING_STATE_COUNT> mTimeInStateMicros;
+
+    /**
+     * Time at which the current state has been entered, in microseconds of
+     * the steady clock, guarded by mStateTimeMutex.
+     */
+    long long mStateEnteredAtMicros;
+
+    /**
+     * Published together with mCurrentMonitoringState.
+     */
+    mutable std::mutex mStateTimeMutex;
+
     /**
      *
      */
     std::mutex mMutex;
+
+    /**
+     * Events waiting to be processed, guarded by mEventQueueMutex.
+     */
+    std::deque<InternalEvent> mEventQueue;
+
+    /**
+     * True while a thread is processing the queued events, guarded by
+     * mEventQueueMutex.
+     */
+    bool mProcessingEvents;
+
+    /**
+     * Guarded by mEventQueueMutex.
+     */
+    int mMaxEventQueueDepth;
+
+    /**
+     * Guarded by mEventQueueMutex.
+     */
+    long mCoalescedEventCount;
+
+    /**
+     * Distinct from mMutex so that queuing an event never waits for a state
+     * switch.
+     */
+    std::mutex mEventQueueMutex;
+
+    /**
+     * Returns the position of the provided state in mStates.
+     */
+    static std::size_t stateIndex(const MonitoringState state);
+
+    /**
+     * Returns the current time of the steady clock in microseconds.
+     */
+    static long long steadyClockMicros();
+
+    /**
+     * Processes an event against the current state.
+     */
+    void processEvent(const InternalEvent event);
+
+    /**
+     * Notifies an error raised by the processing of an event to the
+     * observation exception handler of the reader.
+     */
+    void notifyEventProcessingError(
+        const InternalEvent event, const Exception& e);
 };
 
 } /* namespace service */
@@ -14,12 +14,16 @@
 #pragma once
 
 #include <algorithm>
+#include <chrono>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
 
 #include "keyple/core/service/KeypleServiceExport.hpp"
+#include "keyple/core/service/cpp/ExecutorService.hpp"
+#include "keyple/core/service/cpp/MonitoringThreadPool.hpp"
 #include "keyple/core/util/KeypleAssert.hpp"
 #include "keyple/core/util/cpp/LoggerFactory.hpp"
 #include "keyple/core/util/cpp/exception/IllegalStateException.hpp"
@@ -28,6 +32,8 @@ namespace keyple {
 namespace core {
 namespace service {
 
+using keyple::core::service::cpp::ExecutorService;
+using keyple::core::service::cpp::MonitoringThreadPool;
 using keyple::core::util::Assert;
 using keyple::core::util::cpp::LoggerFactory;
 using keyple::core::util::cpp::exception::IllegalStateException;
@@ -110,6 +116,9 @@ public:
         mObservers.erase(
             std::remove(mObservers.begin(), mObservers.end(), observer),
             mObservers.end());
+
+        /* Pending notifications are still delivered */
+        mEventNotificationExecutors.erase(observer);
     }
 
     /**
@@ -125,6 +134,9 @@ public:
         const std::lock_guard<std::mutex> lock(mMonitor);
 
         mObservers.clear();
+
+        /* Pending notifications are still delivered */
+        mEventNotificationExecutors.clear();
     }
 
     /**
@@ -182,6 +194,119 @@ public:
         return mExceptionHandler;
     }
 
+    /**
+     * Sets the thread pool on which the events are notified to the
+     * observers.
+     *
+     * <p>Each observer is notified through its own queue, so that it receives
+     * the events in order while the other observers and the monitoring
+     * process are not blocked. A null pool restores the synchronous
+     * notification.
+     *
+     * <p>C++: replaces the Java setEventNotificationExecutorService().
+     *
+     * @param threadPool The thread pool (may be null).
+     * @since 3.3.0
+     */
+    void
+    setEventNotificationThreadPool(
+        std::shared_ptr<MonitoringThreadPool> threadPool)
+    {
+        const std::lock_guard<std::mutex> lock(mMonitor);
+
+        mEventNotificationThreadPool = threadPool;
+        mEventNotificationExecutors.clear();
+    }
+
+    /**
+     * Gets the thread pool on which the events are notified to the
+     * observers.
+     *
+     * @return Null if the events are notified synchronously.
+     * @since 3.3.0
+     */
+    std::shared_ptr<MonitoringThreadPool>
+    getEventNotificationThreadPool()
+    {
+        const std::lock_guard<std::mutex> lock(mMonitor);
+
+        return mEventNotificationThreadPool;
+    }
+
+    /**
+     * Gets the executor notifying the events to the provided observer,
+     * creating it if needed.
+     *
+     * @param observer The observer.
+     * @return Null if the events are notified synchronously or if the
+     * observer is no longer registered.
+     * @since 3.3.0
+     */
+    std::shared_ptr<ExecutorService>
+    getEventNotificationExecutor(std::shared_ptr<T> observer)
+    {
+        const std::lock_guard<std::mutex> lock(mMonitor);
+
+        if (mEventNotificationThreadPool == nullptr) {
+            return nullptr;
+        }
+
+        const auto it = mEventNotificationExecutors.find(observer);
+        if (it != mEventNotificationExecutors.end()) {
+            return it->second;
+        }
+
+        if (std::find(mObservers.begin(), mObservers.end(), observer)
+            == mObservers.end()) {
+            return nullptr;
+        }
+
+        const auto executorService
+            = std::make_shared<ExecutorService>(mEventNotificationThreadPool);
+        mEventNotificationExecutors.insert({observer, executorService});
+
+        return executorService;
+    }
+
+    /**
+     * Blocks until the events already queued have been notified to all the
+     * observers, or the provided delay has elapsed.
+     *
+     * @param timeoutMillis The maximum waiting time in milliseconds.
+     * @return True if no notification is pending anymore.
+     * @since 3.3.0
+     */
+    bool
+    awaitEventNotifications(const long timeoutMillis)
+    {
+        std::vector<std::shared_ptr<ExecutorService>> executorServices;
+
+        {
+            const std::lock_guard<std::mutex> lock(mMonitor);
+
+            for (const auto& entry : mEventNotificationExecutors) {
+                executorServices.push_back(entry.second);
+            }
+        }
+
+        const auto deadline = std::chrono::steady_clock::now()
+                              + std::chrono::milliseconds(timeoutMillis);
+
+        for (const auto& executorService : executorServices) {
+            const auto remaining
+                = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      deadline - std::chrono::steady_clock::now())
+                      .count();
+
+            if (!executorService->awaitIdle(
+                    std::max(static_cast<long>(remaining), 0L))) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
 private:
     /**
      *
@@ -208,6 +333,18 @@ private:
      *
      */
     std::mutex mMonitor;
+
+    /**
+     * Null when the events are notified synchronously, guarded by mMonitor.
+     */
+    std::shared_ptr<MonitoringThreadPool> mEventNotificationThreadPool;
+
+    /**
+     * One executor per observer, to keep the events of an observer in order,
+     * guarded by mMonitor.
+     */
+    std::map<std::shared_ptr<T>, std::shared_ptr<ExecutorService>>
+        mEventNotificationExecutors;
 };
 
 } /* namespace service */
@@ -0,0 +1,115 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#pragma once
+
+#include <exception>
+#include <memory>
+
+#include "keyple/core/service/KeypleServiceExport.hpp"
+#include "keypop/reader/CardReader.hpp"
+#include "keypop/reader/selection/CardSelectionResult.hpp"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using keypop::reader::CardReader;
+using keypop::reader::selection::CardSelectionResult;
+
+/**
+ * Outcome of a card selection scenario processed on one of the readers of
+ * CardSelectionManagerAdapter::processCardSelectionScenarioInParallel().
+ *
+ * @since 3.3.0
+ */
+class KEYPLESERVICE_API ParallelCardSelectionResult final {
+public:
+    /**
+     * Constructor.
+     *
+     * @param reader The reader.
+     * @param cardSelectionResult The result, null if the processing failed.
+     * @param exception The failure, null if the processing succeeded.
+     * @param elapsedMicros The duration of the card exchanges.
+     * @since 3.3.0
+     */
+    ParallelCardSelectionResult(
+        const std::shared_ptr<CardReader> reader,
+        const std::shared_ptr<CardSelectionResult> cardSelectionResult,
+        const std::exception_ptr exception,
+        const long long elapsedMicros);
+
+    /**
+     * Returns the reader on which the scenario was processed.
+     *
+     * @return A not null reference.
+     * @since 3.3.0
+     */
+    std::shared_ptr<CardReader> getReader() const;
+
+    /**
+     * Returns the result of the scenario.
+     *
+     * @return Null if the processing failed.
+     * @since 3.3.0
+     */
+    std::shared_ptr<CardSelectionResult> getCardSelectionResult() const;
+
+    /**
+     * Returns the exception which interrupted the processing, the one
+     * CardSelectionManager::processCardSelectionScenario() would have thrown
+     * (e.g. ReaderCommunicationException, CardCommunicationException,
+     * InvalidCardResponseException).
+     *
+     * <p>C++: to be rethrown with std::rethrow_exception().
+     *
+     * @return Null if the processing succeeded.
+     * @since 3.3.0
+     */
+    std::exception_ptr getException() const;
+
+    /**
+     * Returns the duration of the card exchanges with the reader, the
+     * response parsing excluded.
+     *
+     * @return A duration in microseconds.
+     * @since 3.3.0
+     */
+    long long getElapsedMicros() const;
+
+private:
+    /**
+     *
+     */
+    const std::shared_ptr<CardReader> mReader;
+
+    /**
+     *
+     */
+    const std::shared_ptr<CardSelectionResult> mCardSelectionResult;
+
+    /**
+     *
+     */
+    const std::exception_ptr mException;
+
+    /**
+     *
+     */
+    const long long mElapsedMicros;
+};
+
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -24,6 +25,7 @@
 #include "keyple/core/plugin/spi/PoolPluginFactorySpi.hpp"
 #include "keyple/core/service/AbstractPluginAdapter.hpp"
 #include "keyple/core/service/KeypleServiceExport.hpp"
+#include "keyple/core/service/MonitoringState.hpp"
 #include "keyple/core/service/SmartCardService.hpp"
 #include "keyple/core/util/cpp/LoggerFactory.hpp"
 
@@ -37,6 +39,8 @@
 #include "keyple/core/service/LocalPoolPluginAdapter.hpp"
 #include "keyple/core/service/ObservableLocalPluginAdapter.hpp"
 #include "keyple/core/service/ReaderApiFactoryAdapter.hpp"
+#include "keyple/core/service/cpp/MonitoringThreadPool.hpp"
+#include "keyple/core/service/cpp/TimerWheel.hpp"
 #include "keyple/core/util/KeypleAssert.hpp"
 #include "keyple/core/util/cpp/StringUtils.hpp"
 #include "keyple/core/util/cpp/exception/IllegalArgumentException.hpp"
@@ -63,6 +67,8 @@ using keyple::core::service::AutonomousObservableLocalPluginAdapter;
 using keyple::core::service::KeyplePluginException;
 using keyple::core::service::LocalPoolPluginAdapter;
 using keyple::core::service::ReaderApiFactoryAdapter;
+using keyple::core::service::cpp::MonitoringThreadPool;
+using keyple::core::service::cpp::TimerWheel;
 using keyple::core::util::Assert;
 using keyple::core::util::cpp::StringUtils;
 using keyple::core::util::cpp::exception::IllegalArgumentException;
@@ -272,6 +278,155 @@ public:
      */
     std::unique_ptr<ReaderApiFactory> getReaderApiFactory() final;
 
+    /**
+     * Makes the observable readers created from now on run their card
+     * monitoring jobs on a thread pool shared service-wide instead of on a
+     * dedicated thread per reader.
+     *
+     * <p>The events of a given reader are still processed in order. Readers
+     * already registered keep their dedicated thread, so this method should
+     * be called before registering the plugins.
+     *
+     * @param coreThreadCount The number of workers kept alive (at least 1).
+     * @param keepAliveMillis The idle delay (in milliseconds) after which an
+     *        additional worker, spawned when all workers are busy, exits.
+     * @param maxThreadCount The maximum number of workers shared by the
+     *        polling monitoring jobs and the event processing. A monitoring job
+     *        blocked in the plugin always gets a worker of its own, beyond
+     *        this maximum.
+     * @throw IllegalArgumentException If an argument is out of range.
+     * @throw IllegalStateException If a pool is already configured.
+     * @since 3.3.0
+     */
+    void setMonitoringThreadPool(
+        const int coreThreadCount,
+        const long keepAliveMillis,
+        const int maxThreadCount
+        = MonitoringThreadPool::DEFAULT_MAX_THREAD_COUNT);
+
+    /**
+     * Returns the thread pool shared by the card monitoring jobs.
+     *
+     * @return Null if no pool is configured (one thread per reader).
+     * @since 3.3.0
+     */
+    std::shared_ptr<MonitoringThreadPool> getMonitoringThreadPool() const;
+
+    /**
+     * Makes the observable plugins and readers created from now on notify
+     * their events to each observer from a thread pool shared service-wide,
+     * instead of from their monitoring thread.
+     *
+     * <p>Each observer still receives the events of a plugin or a reader in
+     * order, but a long event processing no longer delays the monitoring. The
+     * pool of a given plugin or reader can also be set with
+     * AbstractObservableLocalPluginAdapter::setEventNotificationThreadPool()
+     * or ObservableLocalReaderAdapter::setEventNotificationThreadPool().
+     *
+     * @param coreThreadCount The number of workers kept alive (at least 1).
+     * @param keepAliveMillis The idle delay (in milliseconds) after which an
+     *        additional worker exits.
+     * @param maxThreadCount The maximum number of workers. Beyond it, the
+     *        pending tasks wait for a worker to be released.
+     * @throw IllegalArgumentException If an argument is out of range.
+     * @throw IllegalStateException If a pool is already configured.
+     * @since 3.3.0
+     */
+    void setEventNotificationThreadPool(
+        const int coreThreadCount,
+        const long keepAliveMillis,
+        const int maxThreadCount
+        = MonitoringThreadPool::DEFAULT_MAX_THREAD_COUNT);
+
+    /**
+     * Returns the thread pool notifying the plugin and reader events.
+     *
+     * @return Null if the events are notified synchronously.
+     * @since 3.3.0
+     */
+    std::shared_ptr<MonitoringThreadPool>
+    getEventNotificationThreadPool() const;
+
+    /**
+     * Makes the readers run the card requests submitted through
+     * AbstractReaderAdapter::transmitCardRequestAsync() and
+     * transmitCardSelectionRequestsAsync() on a thread pool shared
+     * service-wide, instead of on an I/O thread per reader.
+     *
+     * <p>The requests of a given reader are still executed in submission
+     * order. Readers which have already started their I/O worker keep it, so
+     * this method should be called before registering the plugins.
+     *
+     * @param coreThreadCount The number of workers kept alive (at least 1).
+     * @param keepAliveMillis The idle delay (in milliseconds) after which an
+     *        additional worker exits.
+     * @param maxThreadCount The maximum number of workers. Beyond it, the
+     *        pending tasks wait for a worker to be released.
+     * @throw IllegalArgumentException If an argument is out of range.
+     * @throw IllegalStateException If a pool is already configured.
+     * @since 3.3.0
+     */
+    void setCardIoThreadPool(
+        const int coreThreadCount,
+        const long keepAliveMillis,
+        const int maxThreadCount
+        = MonitoringThreadPool::DEFAULT_MAX_THREAD_COUNT);
+
+    /**
+     * Returns the thread pool running the asynchronous card requests.
+     *
+     * @return Null if each reader uses its own I/O thread.
+     * @since 3.3.0
+     */
+    std::shared_ptr<MonitoringThreadPool> getCardIoThreadPool() const;
+
+    /**
+     * Returns the timer wheel pacing the card presence polls of all the
+     * observable readers using active (non-blocking) card monitoring.
+     *
+     * <p>The wheel is created on first use, with a tick of
+     * MONITORING_TIMER_TICK_MILLIS, and its thread does not consume any CPU
+     * while no poll is pending.
+     *
+     * @return A not null reference.
+     * @since 3.3.0
+     */
+    std::shared_ptr<TimerWheel> getMonitoringTimerWheel();
+
+    /**
+     * Sets the maximum time an observable reader waits for its running
+     * monitoring job to exit when it is unregistered (1000 ms by default).
+     *
+     * @param timeoutMillis The delay in milliseconds (positive or zero).
+     * @throw IllegalArgumentException If the delay is negative.
+     * @since 3.3.0
+     */
+    void setMonitoringStopTimeout(const long timeoutMillis);
+
+    /**
+     * Returns the maximum time an observable reader waits for its running
+     * monitoring job to exit when it is unregistered.
+     *
+     * @return A delay in milliseconds.
+     * @since 3.3.0
+     */
+    long getMonitoringStopTimeout() const;
+
+    /**
+     * Returns the current monitoring state of every observable local reader
+     * of the registered plugins.
+     *
+     * <p>The states are read without taking any reader lock, so that the
+     * snapshot can be polled frequently (e.g. by a supervision tool) without
+     * disturbing the card monitoring. Each state is consistent on its own,
+     * not with the others.
+     *
+     * @return A map of the states by reader name, empty if there is no
+     *         observable local reader.
+     * @since 3.3.0
+     */
+    std::map<std::string, MonitoringState> getMonitoringStateSnapshot() const;
+
 private:
     /**
      *
@@ -280,15 +435,64 @@ private:
         = LoggerFactory::getLogger(typeid(SmartCardServiceAdapter));
 
     /**
-     *
+     * Guards mPlugins.
      */
-    std::mutex mMutex;
+    mutable std::mutex mMutex;
 
     /**
      *
      */
     std::map<std::string, std::shared_ptr<Plugin>> mPlugins;
 
+    /**
+     * Guards mMonitoringThreadPool, which is read while mMutex is held by
+     * registerPlugin() (reader creation).
+     */
+    mutable std::mutex mMonitoringThreadPoolMutex;
+
+    /**
+     *
+     */
+    std::shared_ptr<MonitoringThreadPool> mMonitoringThreadPool;
+
+    /**
+     * Created on first use, guarded by mMonitoringThreadPoolMutex.
+     */
+    std::shared_ptr<TimerWheel> mMonitoringTimerWheel;
+
+    /**
+     * Guarded by mMonitoringThreadPoolMutex.
+     */
+    std::shared_ptr<MonitoringThreadPool> mEventNotificationThreadPool;
+
+    /**
+     * Guarded by mMonitoringThreadPoolMutex.
+     */
+    std::shared_ptr<MonitoringThreadPool> mCardIoThreadPool;
+
+    /**
+     * Tick of the monitoring timer wheel, i.e. the maximum delay added to the
+     * sleep duration between two polls.
+     */
+    static const long MONITORING_TIMER_TICK_MILLIS;
+
+    /**
+     * Number of slots of the monitoring timer wheel (one revolution covers
+     * about one second).
+     */
+    static const int MONITORING_TIMER_WHEEL_SIZE;
+
+    /**
+     *
+     */
+    static const long DEFAULT_MONITORING_STOP_TIMEOUT_MILLIS;
+
+    /**
+     *
+     */
+    std::atomic<long> mMonitoringStopTimeoutMillis{
+        DEFAULT_MONITORING_STOP_TIMEOUT_MILLIS};
+
     /**
      *
      */
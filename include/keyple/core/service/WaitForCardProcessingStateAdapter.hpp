@@ -66,20 +66,6 @@ public:
      */
     explicit WaitForCardProcessingStateAdapter(
         ObservableLocalReaderAdapter* reader);
-
-    /**
-     * {@inheritDoc}
-     *
-     * @since 2.0.0
-     */
-    void onEvent(const InternalEvent event) override;
-
-private:
-    /**
-     *
-     */
-    const std::unique_ptr<Logger> mLogger
-        = LoggerFactory::getLogger(typeid(WaitForCardProcessingStateAdapter));
 };
 
 } /* namespace service */
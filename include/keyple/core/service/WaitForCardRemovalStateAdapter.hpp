@@ -64,20 +64,6 @@ public:
      */
     explicit WaitForCardRemovalStateAdapter(
         ObservableLocalReaderAdapter* reader);
-
-    /**
-     * {@inheritDoc}
-     *
-     * @since 2.0.0
-     */
-    void onEvent(const InternalEvent event) override;
-
-private:
-    /**
-     *
-     */
-    const std::unique_ptr<Logger> mLogger
-        = LoggerFactory::getLogger(typeid(WaitForCardRemovalStateAdapter));
 };
 
 } /* namespace service */
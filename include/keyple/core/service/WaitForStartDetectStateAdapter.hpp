@@ -69,20 +69,6 @@ public:
      */
     explicit WaitForStartDetectStateAdapter(
         ObservableLocalReaderAdapter* reader);
-
-    /**
-     * {@inheritDoc}
-     *
-     * @since 2.0.0
-     */
-    void onEvent(const InternalEvent event) override;
-
-private:
-    /**
-     * Logger
-     */
-    const std::unique_ptr<Logger> mLogger
-        = LoggerFactory::getLogger(typeid(WaitForStartDetectStateAdapter));
 };
 
 } /* namespace service */
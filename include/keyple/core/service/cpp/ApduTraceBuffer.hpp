@@ -0,0 +1,207 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "keyple/core/service/KeypleServiceExport.hpp"
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace cpp {
+
+/**
+ * Fixed-size ring buffer keeping a compact record of the last APDU exchanges
+ * of a reader, for post-mortem analysis.
+ *
+ * <p>Recording neither allocates nor formats: only the command header, the
+ * status word, the byte counts and the timestamps are stored. The oldest
+ * records are overwritten once CAPACITY exchanges have been recorded.
+ *
+ * <p>Lock-free: records are written by the thread processing the reader
+ * transactions and may be read at any time from any thread, a record being
+ * overwritten while it is read is skipped rather than returned torn.
+ *
+ * @since 3.3.0
+ */
+class KEYPLESERVICE_API ApduTraceBuffer final {
+public:
+    /**
+     * Number of records kept.
+     *
+     * @since 3.3.0
+     */
+    static const std::size_t CAPACITY = 128;
+
+    /**
+     * Number of command bytes kept (CLA, INS, P1, P2, P3).
+     *
+     * @since 3.3.0
+     */
+    static const std::size_t HEADER_LENGTH = 5;
+
+    /**
+     * Copy of one recorded APDU exchange.
+     *
+     * @since 3.3.0
+     */
+    struct KEYPLESERVICE_API Record {
+        /**
+         * Rank of the exchange since the creation of the buffer.
+         */
+        uint64_t sequenceNumber;
+
+        /**
+         * System::nanoTime() before the command was sent.
+         */
+        uint64_t commandTimestampNanos;
+
+        /**
+         * System::nanoTime() after the response was received (or the
+         * exchange failed).
+         */
+        uint64_t responseTimestampNanos;
+
+        /**
+         * First command bytes, zero padded if the command is shorter.
+         */
+        std::array<uint8_t, HEADER_LENGTH> commandHeader;
+
+        /**
+         * Length of the command.
+         */
+        uint32_t commandLength;
+
+        /**
+         * Length of the response, status word included.
+         */
+        uint32_t responseLength;
+
+        /**
+         * Status word of the response, -1 if the exchange failed.
+         */
+        int statusWord;
+
+        /**
+         *
+         */
+        friend KEYPLESERVICE_API std::ostream&
+        operator<<(std::ostream& os, const Record& r);
+    };
+
+    /**
+     * Constructor.
+     *
+     * @since 3.3.0
+     */
+    ApduTraceBuffer();
+
+    /**
+     * Records a completed exchange.
+     *
+     * @param command The command sent to the card.
+     * @param response The response received, status word included.
+     * @param commandTimestampNanos The time at which the command was sent.
+     * @param responseTimestampNanos The time at which the response was
+     *        received.
+     * @since 3.3.0
+     */
+    void record(
+        const std::vector<uint8_t>& command,
+        const std::vector<uint8_t>& response,
+        const uint64_t commandTimestampNanos,
+        const uint64_t responseTimestampNanos);
+
+    /**
+     * Records an exchange interrupted by a communication failure.
+     *
+     * @param command The command sent to the card.
+     * @param commandTimestampNanos The time at which the command was sent.
+     * @param failureTimestampNanos The time at which the failure occurred.
+     * @since 3.3.0
+     */
+    void recordFailure(
+        const std::vector<uint8_t>& command,
+        const uint64_t commandTimestampNanos,
+        const uint64_t failureTimestampNanos);
+
+    /**
+     * Returns a copy of the kept records, oldest first.
+     *
+     * @since 3.3.0
+     */
+    std::vector<Record> snapshot() const;
+
+    /**
+     * Returns the number of exchanges recorded since the creation of the
+     * buffer, including the overwritten ones.
+     *
+     * @since 3.3.0
+     */
+    uint64_t getRecordCount() const;
+
+    /**
+     *
+     */
+    ApduTraceBuffer(const ApduTraceBuffer& o) = delete;
+
+    /**
+     *
+     */
+    ApduTraceBuffer& operator=(const ApduTraceBuffer& o) = delete;
+
+private:
+    /**
+     * A record packed into atomic words, guarded by a sequence lock: mVersion
+     * is odd while the slot is written, 2 * (sequenceNumber + 1) once done.
+     */
+    struct Slot {
+        std::atomic<uint64_t> mVersion;
+        std::atomic<uint64_t> mCommandTimestampNanos;
+        std::atomic<uint64_t> mResponseTimestampNanos;
+        std::atomic<uint64_t> mHeaderAndStatusWord;
+        std::atomic<uint64_t> mLengths;
+    };
+
+    /**
+     *
+     */
+    std::array<Slot, CAPACITY> mSlots;
+
+    /**
+     * Sequence number of the next record.
+     */
+    std::atomic<uint64_t> mNextSequenceNumber;
+
+    /**
+     *
+     */
+    void write(
+        const std::vector<uint8_t>& command,
+        const uint32_t responseLength,
+        const int statusWord,
+        const uint64_t commandTimestampNanos,
+        const uint64_t responseTimestampNanos);
+};
+
+} /* namespace cpp */
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
@@ -0,0 +1,99 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#include "keyple/core/service/KeypleServiceExport.hpp"
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace cpp {
+
+/**
+ * Cooperative cancellation flag shared between a monitoring job and the
+ * threads stopping it.
+ *
+ * <p>C++: replaces the Java thread interruption. Jobs check the token between
+ * two steps and use waitForCancellation() instead of sleeping, so that a
+ * cancellation request is taken into account immediately.
+ *
+ * @since 3.3.0
+ */
+class KEYPLESERVICE_API CancellationToken final {
+public:
+    /**
+     *
+     */
+    CancellationToken();
+
+    /**
+     * Requests the cancellation and wakes up the threads blocked in
+     * waitForCancellation(). Subsequent calls have no effect.
+     *
+     * @since 3.3.0
+     */
+    void cancel();
+
+    /**
+     * Returns true if the cancellation has been requested.
+     *
+     * @since 3.3.0
+     */
+    bool isCancellationRequested() const;
+
+    /**
+     * Blocks until the cancellation is requested or the provided delay has
+     * elapsed, whichever comes first.
+     *
+     * @param timeoutMillis The maximum waiting time in milliseconds.
+     * @return True if the cancellation has been requested.
+     * @since 3.3.0
+     */
+    bool waitForCancellation(const long timeoutMillis);
+
+    /**
+     *
+     */
+    CancellationToken(const CancellationToken& o) = delete;
+
+    /**
+     *
+     */
+    CancellationToken& operator=(const CancellationToken& o) = delete;
+
+private:
+    /**
+     *
+     */
+    std::atomic<bool> mCancelled;
+
+    /**
+     *
+     */
+    std::mutex mMutex;
+
+    /**
+     * Signaled when the cancellation is requested.
+     */
+    std::condition_variable mCondition;
+};
+
+} /* namespace cpp */
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
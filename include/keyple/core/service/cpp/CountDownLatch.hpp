@@ -0,0 +1,108 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+
+#include "keyple/core/service/KeypleServiceExport.hpp"
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace cpp {
+
+/**
+ * Emulates a Java CountDownLatch: threads calling await() are blocked until
+ * the count reaches zero.
+ *
+ * <p>C++: used as start and termination signal of the service threads
+ * instead of spinning on plain boolean flags.
+ *
+ * @since 3.3.0
+ */
+class KEYPLESERVICE_API CountDownLatch final {
+public:
+    /**
+     * Constructor.
+     *
+     * @param count The number of countDown() calls needed to release the
+     *        waiting threads.
+     * @since 3.3.0
+     */
+    explicit CountDownLatch(const int count);
+
+    /**
+     * Decrements the count and releases the waiting threads when it reaches
+     * zero. Has no effect if the count is already zero.
+     *
+     * @since 3.3.0
+     */
+    void countDown();
+
+    /**
+     * Returns the current count.
+     *
+     * @since 3.3.0
+     */
+    int getCount() const;
+
+    /**
+     * Blocks until the count reaches zero.
+     *
+     * @since 3.3.0
+     */
+    void await();
+
+    /**
+     * Blocks until the count reaches zero or the provided delay has elapsed,
+     * whichever comes first.
+     *
+     * @param timeoutMillis The maximum waiting time in milliseconds.
+     * @return True if the count reached zero.
+     * @since 3.3.0
+     */
+    bool await(const long timeoutMillis);
+
+    /**
+     *
+     */
+    CountDownLatch(const CountDownLatch& o) = delete;
+
+    /**
+     *
+     */
+    CountDownLatch& operator=(const CountDownLatch& o) = delete;
+
+private:
+    /**
+     * Guarded by mMutex.
+     */
+    int mCount;
+
+    /**
+     *
+     */
+    mutable std::mutex mMutex;
+
+    /**
+     * Signaled when the count reaches zero.
+     */
+    std::condition_variable mCondition;
+};
+
+} /* namespace cpp */
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
@@ -13,46 +13,126 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <typeinfo>
-#include <vector>
 
 #include "keyple/core/service/KeypleServiceExport.hpp"
 #include "keyple/core/service/cpp/Job.hpp"
+#include "keyple/core/service/cpp/JobFuture.hpp"
+#include "keyple/core/service/cpp/MonitoringThreadPool.hpp"
 
 namespace keyple {
 namespace core {
 namespace service {
 namespace cpp {
 
-class KEYPLESERVICE_API ExecutorService final {
+/**
+ * Emulates a Java SingleThreadExecutor: jobs are run one after the other, in
+ * submission order, by a single worker thread.
+ *
+ * <p>The worker thread blocks on a condition variable while the queue is
+ * empty, so a submitted job is started as soon as the worker is notified and
+ * an idle executor does not consume any CPU.
+ *
+ * <p>When built on a MonitoringThreadPool, the executor does not own a thread:
+ * its jobs are run one after the other by the workers of the pool and no
+ * thread is used while the queue is empty. A blocking job (see
+ * Job::isBlocking()) is run on a worker of its own.
+ */
+class KEYPLESERVICE_API ExecutorService final
+: public std::enable_shared_from_this<ExecutorService> {
 public:
     /**
-     *
+     * Creates an executor running its jobs on a dedicated thread.
      */
     ExecutorService();
 
     /**
+     * Creates an executor running its jobs on the provided shared pool.
+     *
+     * <p>/!\ C++: the executor must be owned by a std::shared_ptr.
      *
+     * @param threadPool The shared pool (must not be null).
+     */
+    explicit ExecutorService(std::shared_ptr<MonitoringThreadPool> threadPool);
+
+    /**
+     * Shuts down the executor.
+     *
+     * <p>If a bounded shutdown has already given up on the running job, the
+     * job is not waited for again: the dedicated thread is detached and exits
+     * once the job returns.
      */
     ~ExecutorService();
 
     /**
+     * Queues the provided job for execution and wakes up the worker thread.
      *
+     * <p>Jobs submitted after shutdown() are ignored.
      */
     void execute(std::shared_ptr<Job> job);
 
     /**
+     * Queues the provided task for execution, in the same queue as the jobs.
      *
+     * <p>Tasks submitted after shutdown() are ignored.
      */
-    std::shared_ptr<Job> submit(std::shared_ptr<Job> job);
+    void execute(const std::function<void()>& task);
 
     /**
+     * Same as execute() but returns a handle on the submitted job so that the
+     * caller can wait for its completion.
      *
+     * @return A not null reference.
+     */
+    std::shared_ptr<JobFuture> submit(std::shared_ptr<Job> job);
+
+    /**
+     * Stops the worker thread once the currently running job (if any) is
+     * completed. Pending jobs are discarded.
+     *
+     * <p>When built on a shared pool, waits for the currently running job (if
+     * any) to complete; the pool itself is left running.
+     *
+     * <p>/!\ C++: when called from the worker thread itself (e.g. from a job),
+     * the worker is detached instead of joined to avoid a self-join.
      */
     void shutdown();
 
+    /**
+     * Same as shutdown() but the running job (if any) is asked to exit
+     * through its cancellation token and is waited for at most the provided
+     * delay.
+     *
+     * <p>Pending jobs are cancelled so that their waiters are released.
+     *
+     * @param timeoutMillis The maximum waiting time in milliseconds (negative
+     * to wait without deadline).
+     * @return True if no job is running anymore, false if the delay elapsed
+     * first. The worker thread is then joined by a later shutdown() call, or
+     * detached by the destructor if the job is still running.
+     * @since 3.3.0
+     */
+    bool shutdown(const long timeoutMillis);
+
+    /**
+     * Blocks until all the queued jobs have been run or the provided delay
+     * has elapsed.
+     *
+     * @param timeoutMillis The maximum waiting time in milliseconds (negative
+     * to wait without deadline).
+     * @return True if the queue is empty and no job is running, false if the
+     * delay elapsed first or if called from a job of this executor.
+     * @since 3.3.0
+     */
+    bool awaitIdle(const long timeoutMillis);
+
     /**
      * /!\ MSVC requires operator= to be deleted because of std::future
      * not being copyable.
@@ -67,29 +147,120 @@ public:
 
 private:
     /**
-     *
+     * Queued task, with the job it runs (null for plain tasks).
      */
-    std::vector<std::shared_ptr<Job>> mPool;
+    struct Task {
+        std::function<void()> mFunction;
+        std::shared_ptr<Job> mJob;
+    };
 
     /**
-     *
+     * State used by the worker, shared with the dedicated thread so that the
+     * thread can outlive the executor once detached.
      */
-    void run();
+    struct State {
+        State()
+        : mRunning(true)
+        , mDrainScheduled(false)
+        {
+        }
+
+        /**
+         * Pending jobs, guarded by mMutex.
+         */
+        std::deque<Task> mPool;
+
+        /**
+         *
+         */
+        std::mutex mMutex;
+
+        /**
+         * Signaled when a job is queued or when the executor is shut down.
+         */
+        std::condition_variable mCondition;
+
+        /**
+         * Signaled when the running task (if any) is completed.
+         */
+        std::condition_variable mIdleCondition;
+
+        /**
+         *
+         */
+        std::atomic<bool> mRunning;
+
+        /**
+         * True while a drain() task is queued or running in the shared pool,
+         * guarded by mMutex.
+         */
+        bool mDrainScheduled;
+
+        /**
+         * Id of the thread running a task, default id otherwise, guarded by
+         * mMutex.
+         */
+        std::thread::id mTaskThreadId;
+
+        /**
+         * Job being run (if any), guarded by mMutex.
+         */
+        std::shared_ptr<Job> mRunningJob;
+    };
 
     /**
      *
      */
-    std::atomic<bool> mRunning;
+    const std::shared_ptr<State> mState;
 
     /**
-     *
+     * Dedicated thread, not started when a shared pool is used.
      */
-    std::atomic<bool> mTerminated;
+    std::thread mThread;
 
     /**
      *
      */
-    std::thread* mThread;
+    std::shared_ptr<MonitoringThreadPool> mThreadPool;
+
+    /**
+     * True once a bounded shutdown has given up waiting for the running job,
+     * guarded by mState->mMutex.
+     */
+    bool mShutdownTimedOut;
+
+    /**
+     * Queues a task and wakes up (or schedules) the worker.
+     */
+    void enqueue(const Task& task);
+
+    /**
+     * Runs a task popped from the queue, the lock being released meanwhile.
+     */
+    static void runTask(
+        State& state, std::unique_lock<std::mutex>& lock, const Task& task);
+
+    /**
+     * Worker loop of the dedicated thread.
+     */
+    static void run(const std::shared_ptr<State> state);
+
+    /**
+     * Returns true if the provided task runs a blocking job.
+     */
+    static bool isBlocking(const Task& task);
+
+    /**
+     * Queues a drain() task in the shared pool.
+     */
+    void scheduleDrain(const bool blocking);
+
+    /**
+     * Runs the queued jobs on a worker of the shared pool until the queue is
+     * empty. When the worker is shared by the non blocking tasks, stops
+     * before a blocking job and reschedules itself as a blocking task.
+     */
+    void drain(const bool blocking);
 };
 
 } /* namespace cpp */
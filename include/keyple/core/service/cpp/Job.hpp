@@ -14,10 +14,18 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
 #include <future>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "keyple/core/service/KeypleServiceExport.hpp"
+#include "keyple/core/service/cpp/CancellationToken.hpp"
 #include "keyple/core/util/cpp/Thread.hpp"
 
 namespace keyple {
@@ -35,7 +43,15 @@ public:
     explicit Job(const std::string& name);
 
     /**
+     * Attempts to cancel the job.
      *
+     * <p>A job cancelled before being started is never run. When
+     * mayInterruptIfRunning is true, the cancellation token of the job is
+     * cancelled as well so that a running job exits at its next check.
+     *
+     * <p>C++: the interruption is cooperative, see getCancellationToken().
+     *
+     * @return False if the job was already done.
      */
     bool cancel(const bool mayInterruptIfRunning);
 
@@ -46,14 +62,141 @@ public:
 
     /**
      * Returns true if the task is completed
+     *
+     * <p>C++: virtual so that jobs completing asynchronously (e.g. periodic
+     * jobs rescheduled on a TimerWheel) can report their own completion.
      */
-    bool isDone();
+    virtual bool isDone();
+
+    /**
+     * Returns true if the job may wait for an external event for an unbounded
+     * time (e.g. a blocking plugin call).
+     *
+     * <p>C++: a blocking job run on a MonitoringThreadPool gets a worker of
+     * its own, beyond the maximum number of workers of the pool.
+     *
+     * @since 3.3.0
+     */
+    virtual bool isBlocking() const;
+
+    /**
+     * Returns the token the job must check between two steps, and wait on
+     * instead of sleeping.
+     *
+     * @return A not null reference.
+     * @since 3.3.0
+     */
+    std::shared_ptr<CancellationToken> getCancellationToken() const;
+
+    /**
+     * Runs the job, unless it has been cancelled before being started, then
+     * wakes up the threads blocked in waitForCompletion().
+     *
+     * <p>An exception thrown by the job is caught and kept for getException().
+     *
+     * <p>C++: entry point used by ExecutorService.
+     *
+     * @since 3.3.0
+     */
+    void runUnlessCancelled();
+
+    /**
+     * Returns the exception thrown by the job, if any.
+     *
+     * @return A null pointer if the job has not thrown any exception.
+     * @since 3.3.0
+     */
+    std::exception_ptr getException();
+
+    /**
+     * Registers a callback invoked once the job is done, from the thread
+     * completing it (or immediately from the calling thread if the job is
+     * already done).
+     *
+     * <p>The callbacks may still be running when the threads blocked in
+     * waitForCompletion() are woken up.
+     *
+     * @param callback The callback.
+     * @since 3.3.0
+     */
+    void addCompletionCallback(const std::function<void()>& callback);
+
+    /**
+     * Blocks until the job is done or the provided delay has elapsed.
+     *
+     * <p>Returns immediately when called from the thread running the job, as
+     * it could not complete while waiting.
+     *
+     * @param timeoutMillis The maximum waiting time in milliseconds (negative
+     * to wait without deadline).
+     * @return True if the job is done.
+     * @since 3.3.0
+     */
+    bool waitForCompletion(const long timeoutMillis);
+
+protected:
+    /**
+     * Wakes up the threads blocked in waitForCompletion().
+     *
+     * <p>C++: to be called by jobs completing asynchronously whenever the
+     * result of isDone() may have changed.
+     *
+     * @since 3.3.0
+     */
+    void notifyCompletion();
+
+    /**
+     * Records whether the calling thread is running (a step of) the job, so
+     * that waitForCompletion() does not wait for itself.
+     *
+     * <p>C++: to be called by jobs running their steps outside of
+     * runUnlessCancelled().
+     *
+     * @since 3.3.0
+     */
+    void setRunningThread(const bool running);
 
 private:
     /**
      *
      */
-    bool mCancelled;
+    std::atomic<bool> mCancelled;
+
+    /**
+     * True once runUnlessCancelled() has started the job.
+     */
+    std::atomic<bool> mStarted;
+
+    /**
+     *
+     */
+    const std::shared_ptr<CancellationToken> mCancellationToken;
+
+    /**
+     * Thread running the job, default id otherwise, guarded by
+     * mCompletionMutex.
+     */
+    std::thread::id mRunningThreadId;
+
+    /**
+     *
+     */
+    std::mutex mCompletionMutex;
+
+    /**
+     * Signaled when the job may have completed.
+     */
+    std::condition_variable mCompletionCondition;
+
+    /**
+     * Exception thrown by the job, guarded by mCompletionMutex.
+     */
+    std::exception_ptr mException;
+
+    /**
+     * Callbacks waiting for the completion, guarded by mCompletionMutex.
+     */
+    std::vector<std::function<void()>> mCompletionCallbacks;
 };
 
 } /* namespace cpp */
@@ -0,0 +1,132 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+
+#include "keyple/core/service/KeypleServiceExport.hpp"
+#include "keyple/core/service/cpp/Job.hpp"
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace cpp {
+
+/**
+ * Handle of a job submitted to an ExecutorService.
+ *
+ * <p>C++: emulates the Java Future returned by ExecutorService.submit(), with
+ * the waiting methods of std::future so that the completion can be awaited
+ * instead of polled.
+ *
+ * @since 3.3.0
+ */
+class KEYPLESERVICE_API JobFuture final {
+public:
+    /**
+     *
+     */
+    explicit JobFuture(std::shared_ptr<Job> job);
+
+    /**
+     * Attempts to cancel the job, see Job::cancel().
+     *
+     * @since 3.3.0
+     */
+    bool cancel(const bool mayInterruptIfRunning);
+
+    /**
+     * Returns true if the job was cancelled.
+     *
+     * @since 3.3.0
+     */
+    bool isCancelled() const;
+
+    /**
+     * Returns true if the job is completed, cancelled before being started or
+     * failed.
+     *
+     * @since 3.3.0
+     */
+    bool isDone() const;
+
+    /**
+     * Blocks until the job is done.
+     *
+     * <p>Returns immediately when called from the thread running the job.
+     *
+     * @since 3.3.0
+     */
+    void wait() const;
+
+    /**
+     * Blocks until the job is done or the provided delay has elapsed.
+     *
+     * @param timeout The maximum waiting time.
+     * @return std::future_status::ready if the job is done,
+     * std::future_status::timeout otherwise.
+     * @since 3.3.0
+     */
+    template <class Rep, class Period>
+    std::future_status
+    wait_for(const std::chrono::duration<Rep, Period>& timeout) const
+    {
+        const long timeoutMillis = static_cast<long>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(timeout)
+                .count());
+
+        return mJob->waitForCompletion(timeoutMillis)
+                   ? std::future_status::ready
+                   : std::future_status::timeout;
+    }
+
+    /**
+     * Blocks until the job is done then rethrows the exception thrown by the
+     * job, if any.
+     *
+     * @since 3.3.0
+     */
+    void get() const;
+
+    /**
+     * Registers a callback invoked once the job is done, see
+     * Job::addCompletionCallback().
+     *
+     * @param callback The callback.
+     * @since 3.3.0
+     */
+    void onCompletion(const std::function<void()>& callback);
+
+    /**
+     * Returns the submitted job.
+     *
+     * @return A not null reference.
+     * @since 3.3.0
+     */
+    std::shared_ptr<Job> getJob() const;
+
+private:
+    /**
+     *
+     */
+    const std::shared_ptr<Job> mJob;
+};
+
+} /* namespace cpp */
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
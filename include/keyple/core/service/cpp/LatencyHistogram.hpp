@@ -0,0 +1,158 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+#include "keyple/core/service/KeypleServiceExport.hpp"
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace cpp {
+
+/**
+ * Wait-free histogram of durations in microseconds, HDR-style: values are
+ * counted in log-linear buckets so that any reported percentile is within
+ * about 6% of the recorded value, with a constant memory footprint.
+ *
+ * <p>Values up to MAX_TRACKABLE_VALUE are bucketed, larger ones are counted
+ * in the last bucket. The maximum is tracked exactly.
+ *
+ * @since 3.3.0
+ */
+class KEYPLESERVICE_API LatencyHistogram final {
+public:
+    /**
+     * Largest value counted in its own bucket (about 19 hours).
+     *
+     * @since 3.3.0
+     */
+    static const long long MAX_TRACKABLE_VALUE;
+
+    /**
+     * Constructor.
+     *
+     * @since 3.3.0
+     */
+    LatencyHistogram();
+
+    /**
+     * Records a value, negative values are recorded as 0.
+     *
+     * <p>Wait-free, may be called concurrently from any thread.
+     *
+     * @param valueMicros The value in microseconds.
+     * @since 3.3.0
+     */
+    void record(const long long valueMicros);
+
+    /**
+     * Returns the number of recorded values.
+     *
+     * @since 3.3.0
+     */
+    long getCount() const;
+
+    /**
+     * Returns the largest recorded value.
+     *
+     * @return A value in microseconds, 0 if no value has been recorded.
+     * @since 3.3.0
+     */
+    long long getMax() const;
+
+    /**
+     * Returns the value below which the provided percentage of the recorded
+     * values fall (e.g. 50 for the median, 99 for the 99th percentile).
+     *
+     * <p>The upper bound of the bucket holding the value is returned, capped
+     * by the largest recorded value.
+     *
+     * @param percentile A percentage in [0, 100].
+     * @return A value in microseconds, 0 if no value has been recorded.
+     * @throw IllegalArgumentException If percentile is out of range.
+     * @since 3.3.0
+     */
+    long long getValueAtPercentile(const double percentile) const;
+
+    /**
+     * Forgets all the recorded values.
+     *
+     * <p>Values recorded concurrently may be partially kept.
+     *
+     * @since 3.3.0
+     */
+    void reset();
+
+    /**
+     *
+     */
+    LatencyHistogram(const LatencyHistogram& o) = delete;
+
+    /**
+     *
+     */
+    LatencyHistogram& operator=(const LatencyHistogram& o) = delete;
+
+private:
+    /**
+     * Values below this one have a bucket each, above it each power of two
+     * is split into SUB_BUCKET_COUNT / 2 buckets.
+     */
+    static const int SUB_BUCKET_COUNT = 32;
+
+    /**
+     * Position of the most significant bit of MAX_TRACKABLE_VALUE.
+     */
+    static const int MAX_MAGNITUDE = 35;
+
+    /**
+     *
+     */
+    static const std::size_t BUCKET_COUNT
+        = SUB_BUCKET_COUNT + (MAX_MAGNITUDE - 4) * (SUB_BUCKET_COUNT / 2);
+
+    /**
+     *
+     */
+    std::array<std::atomic<long>, BUCKET_COUNT> mBuckets;
+
+    /**
+     *
+     */
+    std::atomic<long> mCount;
+
+    /**
+     *
+     */
+    std::atomic<long long> mMax;
+
+    /**
+     * Returns the bucket in which the provided value is counted.
+     */
+    static std::size_t bucketIndex(const long long value);
+
+    /**
+     * Returns the highest value counted in the provided bucket.
+     */
+    static long long bucketUpperBound(const std::size_t index);
+};
+
+} /* namespace cpp */
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
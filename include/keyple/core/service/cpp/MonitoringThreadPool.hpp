@@ -0,0 +1,234 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+
+#include "keyple/core/service/KeypleServiceExport.hpp"
+#include "keyple/core/util/cpp/LoggerFactory.hpp"
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace cpp {
+
+using keyple::core::util::cpp::Logger;
+using keyple::core::util::cpp::LoggerFactory;
+
+/**
+ * Pool of worker threads shared by the ExecutorService instances of several
+ * observable readers.
+ *
+ * <p>The pool keeps a fixed number of core workers alive. When a task is
+ * queued while all workers are busy the pool spawns an additional worker, up to
+ * a maximum number of workers. Beyond it, the task waits in the queue until a
+ * worker is released. Additional workers exit once they have been idle for the
+ * keep-alive delay.
+ *
+ * <p>A blocking task (e.g. a monitoring job waiting for a card event in a
+ * blocking plugin call) holds its worker for an unbounded time, it is
+ * therefore always given a worker and is not counted in the maximum, which
+ * only bounds the workers shared by the other tasks.
+ *
+ * <p>Ordering between the tasks of a given reader is ensured by the
+ * ExecutorService, which never has more than one task in the pool at a time.
+ *
+ * @since 3.3.0
+ */
+class KEYPLESERVICE_API MonitoringThreadPool final {
+public:
+    /**
+     * Default maximum number of workers of a pool.
+     *
+     * @since 3.3.0
+     */
+    static const int DEFAULT_MAX_THREAD_COUNT;
+
+    /**
+     * Creates a pool and starts its core workers.
+     *
+     * @param coreThreadCount The number of workers kept alive (at least 1).
+     * @param keepAliveMillis The idle delay after which an additional worker
+     *        exits.
+     * @param maxThreadCount The maximum number of workers running the non
+     *        blocking tasks (at least coreThreadCount).
+     * @throw IllegalArgumentException If coreThreadCount is less than 1, if
+     *        keepAliveMillis is negative or if maxThreadCount is less than
+     *        coreThreadCount.
+     * @since 3.3.0
+     */
+    MonitoringThreadPool(
+        const int coreThreadCount,
+        const long keepAliveMillis,
+        const int maxThreadCount = DEFAULT_MAX_THREAD_COUNT);
+
+    /**
+     * Shuts down the pool.
+     *
+     * @since 3.3.0
+     */
+    ~MonitoringThreadPool();
+
+    /**
+     * Queues a task. A new worker is spawned if no worker is idle and if the
+     * maximum number of workers is not reached.
+     *
+     * <p>Tasks queued after shutdown() are ignored.
+     *
+     * @param task The task to run.
+     * @since 3.3.0
+     */
+    void execute(const std::function<void()>& task);
+
+    /**
+     * Same as execute(task) but a blocking task is always given a worker,
+     * spawned beyond the maximum number of workers if needed.
+     *
+     * @param task The task to run.
+     * @param blocking True if the task may hold its worker for an unbounded
+     *        time.
+     * @since 3.3.0
+     */
+    void execute(const std::function<void()>& task, const bool blocking);
+
+    /**
+     * Stops all workers once their current task is completed and discards the
+     * pending tasks.
+     *
+     * @since 3.3.0
+     */
+    void shutdown();
+
+    /**
+     * @return The current number of workers.
+     * @since 3.3.0
+     */
+    int getThreadCount() const;
+
+    /**
+     * @return The maximum number of workers running the non blocking tasks.
+     * @since 3.3.0
+     */
+    int getMaxThreadCount() const;
+
+    /**
+     * /!\ C++: the pool owns threads and is therefore not copyable.
+     */
+    MonitoringThreadPool& operator=(MonitoringThreadPool o) = delete;
+
+    /**
+     * /!\ C++: the pool owns threads and is therefore not copyable.
+     */
+    MonitoringThreadPool(const MonitoringThreadPool& o) = delete;
+
+private:
+    /**
+     *
+     */
+    const std::unique_ptr<Logger> mLogger
+        = LoggerFactory::getLogger(typeid(MonitoringThreadPool));
+
+    /**
+     *
+     */
+    const int mCoreThreadCount;
+
+    /**
+     *
+     */
+    const int mMaxThreadCount;
+
+    /**
+     *
+     */
+    const long mKeepAliveMillis;
+
+    /**
+     * Queued task.
+     */
+    struct Task {
+        std::function<void()> mFunction;
+        bool mBlocking;
+    };
+
+    /**
+     * Pending tasks, guarded by mMutex.
+     */
+    std::deque<Task> mTasks;
+
+    /**
+     * Number of blocking tasks queued or running, guarded by mMutex.
+     */
+    int mBlockingTaskCount;
+
+    /**
+     * True once the starvation of the non blocking tasks has been reported,
+     * until the queue is empty again, guarded by mMutex.
+     */
+    bool mStarvationReported;
+
+    /**
+     * Live workers, guarded by mMutex.
+     */
+    std::map<std::thread::id, std::thread> mWorkers;
+
+    /**
+     * Additional workers which have exited and still need to be joined,
+     * guarded by mMutex.
+     */
+    std::vector<std::thread> mExitedWorkers;
+
+    /**
+     *
+     */
+    int mIdleWorkerCount;
+
+    /**
+     *
+     */
+    bool mRunning;
+
+    /**
+     *
+     */
+    mutable std::mutex mMutex;
+
+    /**
+     * Signaled when a task is queued or when the pool is shut down.
+     */
+    std::condition_variable mCondition;
+
+    /**
+     * Starts a new worker. Must be called with mMutex held.
+     */
+    void startWorker(const bool isCore);
+
+    /**
+     * Worker loop.
+     */
+    void run(const bool isCore);
+};
+
+} /* namespace cpp */
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
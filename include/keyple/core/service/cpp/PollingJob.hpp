@@ -0,0 +1,164 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "keyple/core/service/KeypleServiceExport.hpp"
+#include "keyple/core/service/cpp/ExecutorService.hpp"
+#include "keyple/core/service/cpp/Job.hpp"
+#include "keyple/core/service/cpp/TimerWheel.hpp"
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace cpp {
+
+/**
+ * Job polling a condition periodically without blocking a thread.
+ *
+ * <p>Each poll is run as a short task on the executor of the reader and the
+ * next one is scheduled on a TimerWheel. The job is done once pollOnce()
+ * returns false or the job has been stopped, and no poll is running.
+ *
+ * <p>C++: shared by the active card insertion and card removal monitoring
+ * jobs.
+ *
+ * @since 3.3.0
+ */
+class KEYPLESERVICE_API PollingJob
+: public Job,
+  public std::enable_shared_from_this<PollingJob> {
+public:
+    /**
+     * The job is done once the polling has ended and no poll is running.
+     *
+     * @since 3.3.0
+     */
+    bool isDone() final;
+
+protected:
+    /**
+     * Constructor.
+     *
+     * @param name The name of the job.
+     * @param executorService The executor running the polls.
+     * @param timerWheel The timer pacing the polls.
+     * @since 3.3.0
+     */
+    PollingJob(
+        const std::string& name,
+        std::shared_ptr<ExecutorService> executorService,
+        std::shared_ptr<TimerWheel> timerWheel);
+
+    /**
+     * Performs a poll, then schedules the next one if needed.
+     *
+     * @since 3.3.0
+     */
+    void poll();
+
+    /**
+     * Performs a single poll.
+     *
+     * @return True if the polling must go on.
+     * @since 3.3.0
+     */
+    virtual bool pollOnce() = 0;
+
+    /**
+     * Returns the delay before the next poll.
+     *
+     * <p>Not called with the lock of the job held.
+     *
+     * @param pollCount The number of polls performed so far.
+     * @return A delay in milliseconds.
+     * @since 3.3.0
+     */
+    virtual long getNextPollDelay(const int pollCount) = 0;
+
+    /**
+     * Ends the polling.
+     *
+     * @return True if the polling was still going on and the job has not been
+     *         cancelled, i.e. if the caller is the one which has to report the
+     *         outcome.
+     * @since 3.3.0
+     */
+    bool endPolling();
+
+    /**
+     * Cancels the job and the pending poll, then ends the polling.
+     *
+     * <p>A poll may still be running when this method returns, see
+     * waitForCompletion(). Its outcome is not reported, see endPolling().
+     *
+     * @since 3.3.0
+     */
+    void stopPolling();
+
+private:
+    /**
+     *
+     */
+    const std::shared_ptr<ExecutorService> mExecutorService;
+
+    /**
+     *
+     */
+    const std::shared_ptr<TimerWheel> mTimerWheel;
+
+    /**
+     * True until the polling has ended.
+     */
+    std::atomic<bool> mPolling;
+
+    /**
+     *
+     */
+    std::mutex mMutex;
+
+    /**
+     * Pending poll, guarded by mMutex.
+     */
+    std::shared_ptr<TimerWheel::Timeout> mNextPoll;
+
+    /**
+     * True while a poll is running, guarded by mMutex.
+     */
+    bool mPollRunning;
+
+    /**
+     * Number of polls performed, only accessed by the running poll.
+     */
+    int mPollCount;
+
+    /**
+     * False once the polling has ended or the job has been cancelled.
+     */
+    bool isPolling();
+
+    /**
+     * Schedules the next poll on the timer wheel, mMutex being held.
+     */
+    void scheduleNextPoll(const long delayMillis);
+};
+
+} /* namespace cpp */
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
@@ -0,0 +1,236 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+
+#include "keyple/core/service/KeypleServiceExport.hpp"
+#include "keyple/core/util/cpp/LoggerFactory.hpp"
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace cpp {
+
+using keyple::core::util::cpp::Logger;
+using keyple::core::util::cpp::LoggerFactory;
+
+/**
+ * Hashed timer wheel running delayed tasks on a single thread.
+ *
+ * <p>Time is divided in ticks; a task is stored in the slot of its deadline
+ * tick (modulo the wheel size), so scheduling and cancelling are O(1)
+ * operations regardless of the number of pending tasks. Deadlines farther than
+ * one revolution simply stay in their slot until their tick is reached.
+ *
+ * <p>A task runs at most one tick after its deadline. Tasks are run on the
+ * wheel thread and must therefore be short (typically posting a job to an
+ * ExecutorService). The wheel thread sleeps until the next occupied slot and
+ * does not consume any CPU when no task is pending.
+ *
+ * @since 3.3.0
+ */
+class KEYPLESERVICE_API TimerWheel final {
+public:
+    class Timeout;
+
+private:
+    using Slot = std::list<std::shared_ptr<Timeout>>;
+
+public:
+    /**
+     * Handle of a scheduled task.
+     *
+     * @since 3.3.0
+     */
+    class KEYPLESERVICE_API Timeout final {
+    public:
+        /**
+         * Cancels the task if it has not been run yet.
+         *
+         * @since 3.3.0
+         */
+        void cancel();
+
+        /**
+         * /!\ C++: instances are created by TimerWheel::schedule() only.
+         */
+        Timeout(
+            TimerWheel* wheel,
+            const std::function<void()>& task,
+            const uint64_t deadlineTick);
+
+    private:
+        friend class TimerWheel;
+
+        /**
+         *
+         */
+        TimerWheel* mWheel;
+
+        /**
+         *
+         */
+        std::function<void()> mTask;
+
+        /**
+         *
+         */
+        const uint64_t mDeadlineTick;
+
+        /**
+         * Position in the slot, valid while mScheduled is true. Guarded by the
+         * mutex of the wheel.
+         */
+        Slot::iterator mPosition;
+
+        /**
+         * Guarded by the mutex of the wheel.
+         */
+        bool mScheduled;
+    };
+
+    /**
+     * Creates a wheel and starts its thread.
+     *
+     * @param tickDurationMillis The duration of a tick (at least 1).
+     * @param wheelSize The number of slots (at least 1).
+     * @throw IllegalArgumentException If an argument is out of range.
+     * @since 3.3.0
+     */
+    TimerWheel(const long tickDurationMillis, const int wheelSize);
+
+    /**
+     * Stops the wheel.
+     *
+     * @since 3.3.0
+     */
+    ~TimerWheel();
+
+    /**
+     * Schedules a task to be run once after the provided delay.
+     *
+     * <p>The delay is rounded up to a whole number of ticks (at least one).
+     *
+     * @param task The task to run on the wheel thread.
+     * @param delayMillis The delay in milliseconds.
+     * @return A not null handle allowing to cancel the task.
+     * @since 3.3.0
+     */
+    std::shared_ptr<Timeout>
+    schedule(const std::function<void()>& task, const long delayMillis);
+
+    /**
+     * Stops the wheel thread and discards the pending tasks.
+     *
+     * @since 3.3.0
+     */
+    void shutdown();
+
+    /**
+     * /!\ C++: the wheel owns a thread and is therefore not copyable.
+     */
+    TimerWheel& operator=(TimerWheel o) = delete;
+
+    /**
+     * /!\ C++: the wheel owns a thread and is therefore not copyable.
+     */
+    TimerWheel(const TimerWheel& o) = delete;
+
+private:
+    /**
+     *
+     */
+    const std::unique_ptr<Logger> mLogger
+        = LoggerFactory::getLogger(typeid(TimerWheel));
+
+    /**
+     *
+     */
+    const std::chrono::milliseconds mTickDuration;
+
+    /**
+     *
+     */
+    const std::chrono::steady_clock::time_point mStartTime;
+
+    /**
+     * Guarded by mMutex.
+     */
+    std::vector<Slot> mSlots;
+
+    /**
+     * Number of scheduled tasks, guarded by mMutex.
+     */
+    uint64_t mPendingCount;
+
+    /**
+     * Last tick processed by the wheel thread, guarded by mMutex.
+     */
+    uint64_t mLastTick;
+
+    /**
+     * Tick at which the wheel thread will wake up, guarded by mMutex.
+     */
+    uint64_t mWakeUpTick;
+
+    /**
+     *
+     */
+    bool mRunning;
+
+    /**
+     *
+     */
+    std::mutex mMutex;
+
+    /**
+     * Signaled when an earlier deadline is scheduled or on shutdown.
+     */
+    std::condition_variable mCondition;
+
+    /**
+     *
+     */
+    std::thread mThread;
+
+    /**
+     * @return The number of ticks elapsed since the creation of the wheel.
+     */
+    uint64_t getCurrentTick() const;
+
+    /**
+     * Removes a task from its slot. Must be called with mMutex held.
+     */
+    void unschedule(Timeout& timeout);
+
+    /**
+     * Wheel thread loop.
+     */
+    void run();
+};
+
+} /* namespace cpp */
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
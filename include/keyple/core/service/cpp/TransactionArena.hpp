@@ -0,0 +1,204 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "keyple/core/service/KeypleServiceExport.hpp"
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace cpp {
+
+/**
+ * Monotonic memory arena: memory is carved out of large blocks, never freed
+ * individually, and all of it is given back at once by reset().
+ *
+ * <p>Not thread safe, an arena is filled by a single thread at a time.
+ *
+ * @since 3.3.0
+ */
+class KEYPLESERVICE_API TransactionArena final {
+public:
+    /**
+     * Constructor.
+     *
+     * @param blockSize The size in bytes of the blocks allocated on demand.
+     * @since 3.3.0
+     */
+    explicit TransactionArena(const std::size_t blockSize);
+
+    /**
+     * Returns memory for an object of the provided size and alignment.
+     *
+     * @param size The size in bytes.
+     * @param alignment The alignment, a power of two.
+     * @return A not null pointer.
+     * @since 3.3.0
+     */
+    void* allocate(const std::size_t size, const std::size_t alignment);
+
+    /**
+     * Makes all the memory of the arena available again, in constant time.
+     * The blocks are kept for the next allocations.
+     *
+     * <p>No object allocated in the arena must be alive.
+     *
+     * @since 3.3.0
+     */
+    void reset();
+
+    /**
+     * Returns the number of blocks allocated so far.
+     *
+     * @since 3.3.0
+     */
+    std::size_t getBlockCount() const;
+
+    /**
+     *
+     */
+    TransactionArena(const TransactionArena& o) = delete;
+
+    /**
+     *
+     */
+    TransactionArena& operator=(const TransactionArena& o) = delete;
+
+private:
+    /**
+     *
+     */
+    struct Block {
+        std::unique_ptr<char[]> mData;
+        std::size_t mSize;
+    };
+
+    /**
+     *
+     */
+    const std::size_t mBlockSize;
+
+    /**
+     *
+     */
+    std::vector<Block> mBlocks;
+
+    /**
+     * Index in mBlocks of the block being filled.
+     */
+    std::size_t mCurrentBlock;
+
+    /**
+     * Offset of the free space in the current block.
+     */
+    std::size_t mOffset;
+};
+
+/**
+ * Standard allocator taking its memory from a TransactionArena, the arena
+ * being kept alive by the objects allocated with it.
+ *
+ * <p>Deallocation is a no-op, the memory is recovered when the arena is
+ * reset or destroyed.
+ *
+ * @since 3.3.0
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    /**
+     *
+     */
+    using value_type = T;
+
+    /**
+     * Constructor.
+     *
+     * @param arena The arena to allocate from.
+     * @since 3.3.0
+     */
+    explicit ArenaAllocator(std::shared_ptr<TransactionArena> arena)
+    : mArena(arena)
+    {
+    }
+
+    /**
+     *
+     */
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& o)
+    : mArena(o.mArena)
+    {
+    }
+
+    /**
+     *
+     */
+    T*
+    allocate(const std::size_t n)
+    {
+        return static_cast<T*>(mArena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    /**
+     *
+     */
+    void
+    deallocate(T* p, const std::size_t n)
+    {
+        (void)p;
+        (void)n;
+    }
+
+    /**
+     *
+     */
+    template <typename U>
+    bool
+    operator==(const ArenaAllocator<U>& o) const
+    {
+        return mArena == o.mArena;
+    }
+
+    /**
+     *
+     */
+    template <typename U>
+    bool
+    operator!=(const ArenaAllocator<U>& o) const
+    {
+        return mArena != o.mArena;
+    }
+
+private:
+    /**
+     *
+     */
+    template <typename U>
+    friend class ArenaAllocator;
+
+    /**
+     *
+     */
+    std::shared_ptr<TransactionArena> mArena;
+};
+
+} /* namespace cpp */
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
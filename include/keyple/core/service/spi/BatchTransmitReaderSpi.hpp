@@ -0,0 +1,72 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace spi {
+
+/**
+ * Optional capability of a reader SPI able to transmit a sequence of APDU
+ * commands in a single exchange with the reader (e.g. network attached
+ * readers or SAM multiplexers).
+ *
+ * <p>A plugin offers it by having its ReaderSpi implementation also inherit
+ * from this class. The local reader then sends the APDU requests of a card
+ * request in batches, the analysis of the status words and the GET RESPONSE
+ * and Le replay handling still being done by the service.
+ *
+ * <p>C++: this capability belongs to the plugin API, next to ReaderSpi. Until
+ * it is defined there, it is provided by the service, and a plugin
+ * implementing it depends on the keyple-service headers (header only, no
+ * link dependency). It is meant to move to keyple::core::plugin::spi::reader
+ * without change of signature.
+ *
+ * @since 3.3.0
+ */
+class BatchTransmitReaderSpi {
+public:
+    /**
+     *
+     */
+    virtual ~BatchTransmitReaderSpi() = default;
+
+    /**
+     * Transmits the provided APDU commands in order and returns the responses
+     * of the card.
+     *
+     * <p>The transmission must stop right after the first response whose
+     * status word is not 9000, the following commands not being sent: the
+     * service may have to complete or evaluate this response before going on.
+     *
+     * @param apdusIn The APDU commands, at least 2.
+     * @return The responses received, status word included, in the order of
+     *         the commands (at least 1, at most as many as the commands,
+     *         otherwise the service reports a reader communication failure).
+     * @throw ReaderIOException if the communication with the reader has failed.
+     * @throw CardIOException if the communication with the card has failed.
+     * @since 3.3.0
+     */
+    virtual std::vector<std::vector<uint8_t>>
+    transmitApdus(const std::vector<std::vector<uint8_t>>& apdusIn) = 0;
+};
+
+} /* namespace spi */
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
@@ -0,0 +1,63 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#pragma once
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace spi {
+
+/**
+ * Policy deciding the delay between two card presence polls of a reader
+ * monitored actively (i.e. whose plugin does not notify the card insertion
+ * and removal by itself).
+ *
+ * <p>The policy is consulted after each poll which did not detect any change,
+ * so it can for example slow down the polling while no card is presented,
+ * poll tightly right after a card removal, or follow a time-of-day profile.
+ *
+ * <p>The policy may be shared between several readers and is invoked from
+ * their monitoring threads, possibly concurrently.
+ *
+ * @since 3.3.0
+ */
+class PollingPolicySpi {
+public:
+    /**
+     *
+     */
+    virtual ~PollingPolicySpi() = default;
+
+    /**
+     * Returns the delay to wait before the next card presence poll.
+     *
+     * @param monitorInsertion True while waiting for a card insertion, false
+     *        while waiting for the card removal.
+     * @param pollCount The number of polls already performed since the
+     *        monitoring started (at least 1).
+     * @param defaultDelayMillis The delay configured by the plugin.
+     * @return A delay in milliseconds (a value below 1 is handled as 1).
+     * @since 3.3.0
+     */
+    virtual long getNextPollDelay(
+        const bool monitorInsertion,
+        const int pollCount,
+        const long defaultDelayMillis)
+        = 0;
+};
+
+} /* namespace spi */
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
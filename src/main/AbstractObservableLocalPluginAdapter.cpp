@@ -18,12 +18,15 @@
 #include <vector>
 
 #include "keyple/core/service/PluginEventAdapter.hpp"
+#include "keyple/core/service/SmartCardServiceAdapter.hpp"
+#include "keyple/core/service/cpp/ExecutorService.hpp"
 #include "keyple/core/util/cpp/exception/Exception.hpp"
 
 namespace keyple {
 namespace core {
 namespace service {
 
+using keyple::core::service::cpp::ExecutorService;
 using keyple::core::util::cpp::exception::Exception;
 
 /* ABSTRACT OBSERVABLE LOCAL PLUGIN ADAPTER JOB
@@ -33,7 +36,7 @@ AbstractObservableLocalPluginAdapter::ObservableLocalPluginAdapterJob ::
     ObservableLocalPluginAdapterJob(
         std::shared_ptr<PluginObserverSpi> observer,
         const std::shared_ptr<PluginEvent> event,
-        AbstractObservableLocalPluginAdapter* parent)
+        std::shared_ptr<AbstractObservableLocalPluginAdapter> parent)
 : Job("AbstractObservableLocalPluginAdapter")
 , mObserver(observer)
 , mEvent(event)
@@ -57,6 +60,9 @@ AbstractObservableLocalPluginAdapter::AbstractObservableLocalPluginAdapter(
                           PluginObserverSpi,
                           PluginObservationExceptionHandlerSpi>>("", ""))
 {
+    mObservationManager->setEventNotificationThreadPool(
+        SmartCardServiceAdapter::getInstance()
+            ->getEventNotificationThreadPool());
 }
 
 std::shared_ptr<ObservationManagerAdapter<
@@ -78,10 +84,27 @@ AbstractObservableLocalPluginAdapter::notifyObservers(
         countObservers());
 
     for (const auto& observer : mObservationManager->getObservers()) {
-        notifyObserver(observer, event);
+        const std::shared_ptr<ExecutorService> executorService
+            = mObservationManager->getEventNotificationExecutor(observer);
+
+        if (executorService == nullptr) {
+            notifyObserver(observer, event);
+        } else {
+            /* Asynchronous notification, in order for each observer */
+            executorService->execute(
+                std::make_shared<ObservableLocalPluginAdapterJob>(
+                    observer, event, shared_from_this()));
+        }
     }
 }
 
+void
+AbstractObservableLocalPluginAdapter::setEventNotificationThreadPool(
+    std::shared_ptr<MonitoringThreadPool> threadPool)
+{
+    mObservationManager->setEventNotificationThreadPool(threadPool);
+}
+
 void
 AbstractObservableLocalPluginAdapter::notifyObserver(
     std::shared_ptr<PluginObserverSpi> observer,
@@ -110,6 +133,15 @@ AbstractObservableLocalPluginAdapter::doUnregister()
     notifyObservers(std::make_shared<PluginEventAdapter>(
         getName(), unregisteredReaderNames, PluginEvent::Type::UNAVAILABLE));
 
+    /* Let the pending notifications reach the observers before clearing them */
+    if (!mObservationManager->awaitEventNotifications(
+            SmartCardServiceAdapter::getInstance()
+                ->getMonitoringStopTimeout())) {
+        mLogger->warn(
+            "Plugin [%] unregistered with pending event notifications\n",
+            getName());
+    }
+
     clearObservers();
     LocalPluginAdapter::doUnregister();
 }
@@ -13,15 +13,197 @@
 
 #include "keyple/core/service/AbstractObservableStateAdapter.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <typeinfo>
 
 #include "keyple/core/service/AbstractMonitoringJobAdapter.hpp"
 
+#include "cpp/HotPathLog.hpp"
+
 namespace keyple {
 namespace core {
 namespace service {
 
+using InternalEvent = ObservableLocalReaderAdapter::InternalEvent;
+
+namespace {
+
+/**
+ * What a state does with an event, before switching (or not) to the next
+ * state.
+ */
+enum class TransitionAction {
+    /*
+     * The event is ignored, the state is kept (C++: not named IGNORE, a macro
+     * of WinBase.h)
+     */
+    DROP_EVENT,
+
+    /* The state is switched */
+    SWITCH,
+
+    /*
+     * The default selection is processed: the state is switched to
+     * WAIT_FOR_CARD_PROCESSING and the observers notified if it produced an
+     * event, to WAIT_FOR_CARD_REMOVAL otherwise.
+     */
+    PROCESS_CARD_INSERTED,
+
+    /* The card processing timeout is processed, then the state is switched */
+    PROCESS_TIME_OUT
+};
+
+/**
+ * One cell of the transition table, the next state and the need to close the
+ * channels and notify the card removal depend on the detection mode.
+ */
+struct Transition {
+    TransitionAction action;
+    MonitoringState repeatingState;
+    bool repeatingCardRemoved;
+    MonitoringState singleShotState;
+    bool singleShotCardRemoved;
+};
+
+constexpr Transition
+ignore()
+{
+    return {TransitionAction::DROP_EVENT,
+            MonitoringState::WAIT_FOR_START_DETECTION,
+            false,
+            MonitoringState::WAIT_FOR_START_DETECTION,
+            false};
+}
+
+constexpr Transition
+to(const MonitoringState state, const bool cardRemoved)
+{
+    return {TransitionAction::SWITCH, state, cardRemoved, state, cardRemoved};
+}
+
+constexpr Transition
+toByMode(
+    const TransitionAction action,
+    const MonitoringState repeatingState,
+    const bool repeatingCardRemoved,
+    const MonitoringState singleShotState,
+    const bool singleShotCardRemoved)
+{
+    return {action,
+            repeatingState,
+            repeatingCardRemoved,
+            singleShotState,
+            singleShotCardRemoved};
+}
+
+constexpr std::size_t STATE_COUNT = 4;
+constexpr std::size_t EVENT_COUNT = 6;
+
+static_assert(
+    static_cast<std::size_t>(MonitoringState::WAIT_FOR_CARD_REMOVAL) + 1
+        == STATE_COUNT,
+    "the transition table must cover all the monitoring states");
+static_assert(
+    static_cast<std::size_t>(InternalEvent::TIME_OUT) + 1 == EVENT_COUNT,
+    "the transition table must cover all the internal events");
+
+/**
+ * State x event transition table, rows and columns follow the declaration
+ * order of MonitoringState and InternalEvent.
+ */
+constexpr Transition TRANSITIONS[STATE_COUNT][EVENT_COUNT] = {
+    /* WAIT_FOR_START_DETECTION */
+    {/* CARD_INSERTED */
+     ignore(),
+     /* CARD_REMOVED */
+     ignore(),
+     /* CARD_PROCESSED */
+     ignore(),
+     /* START_DETECT */
+     to(MonitoringState::WAIT_FOR_CARD_INSERTION, false),
+     /* STOP_DETECT */
+     ignore(),
+     /* TIME_OUT */
+     ignore()},
+
+    /* WAIT_FOR_CARD_INSERTION */
+    {/* CARD_INSERTED */
+     toByMode(
+         TransitionAction::PROCESS_CARD_INSERTED,
+         MonitoringState::WAIT_FOR_CARD_PROCESSING,
+         false,
+         MonitoringState::WAIT_FOR_CARD_PROCESSING,
+         false),
+     /* CARD_REMOVED: the card has been removed during default selection */
+     toByMode(
+         TransitionAction::SWITCH,
+         MonitoringState::WAIT_FOR_CARD_INSERTION,
+         false,
+         MonitoringState::WAIT_FOR_START_DETECTION,
+         false),
+     /* CARD_PROCESSED */
+     ignore(),
+     /* START_DETECT */
+     ignore(),
+     /* STOP_DETECT */
+     to(MonitoringState::WAIT_FOR_START_DETECTION, false),
+     /* TIME_OUT */
+     ignore()},
+
+    /* WAIT_FOR_CARD_PROCESSING */
+    {/* CARD_INSERTED */
+     ignore(),
+     /* CARD_REMOVED */
+     toByMode(
+         TransitionAction::SWITCH,
+         MonitoringState::WAIT_FOR_CARD_INSERTION,
+         true,
+         MonitoringState::WAIT_FOR_START_DETECTION,
+         true),
+     /* CARD_PROCESSED */
+     toByMode(
+         TransitionAction::SWITCH,
+         MonitoringState::WAIT_FOR_CARD_REMOVAL,
+         false,
+         MonitoringState::WAIT_FOR_START_DETECTION,
+         true),
+     /* START_DETECT */
+     ignore(),
+     /* STOP_DETECT */
+     to(MonitoringState::WAIT_FOR_START_DETECTION, true),
+     /*
+      * TIME_OUT: the channels are closed and the removal sequence starts as
+      * if the application had finalized the processing
+      */
+     toByMode(
+         TransitionAction::PROCESS_TIME_OUT,
+         MonitoringState::WAIT_FOR_CARD_REMOVAL,
+         false,
+         MonitoringState::WAIT_FOR_START_DETECTION,
+         true)},
+
+    /* WAIT_FOR_CARD_REMOVAL */
+    {/* CARD_INSERTED */
+     ignore(),
+     /* CARD_REMOVED */
+     toByMode(
+         TransitionAction::SWITCH,
+         MonitoringState::WAIT_FOR_CARD_INSERTION,
+         true,
+         MonitoringState::WAIT_FOR_START_DETECTION,
+         true),
+     /* CARD_PROCESSED */
+     ignore(),
+     /* START_DETECT */
+     ignore(),
+     /* STOP_DETECT */
+     to(MonitoringState::WAIT_FOR_START_DETECTION, true),
+     /* TIME_OUT */
+     ignore()}};
+
+} /* namespace */
+
 AbstractObservableStateAdapter::AbstractObservableStateAdapter(
     const MonitoringState monitoringState,
     ObservableLocalReaderAdapter* reader,
@@ -32,6 +214,10 @@ AbstractObservableStateAdapter::AbstractObservableStateAdapter(
 , mMonitoringJob(monitoringJob)
 , mExecutorService(executorService)
 {
+    /* C++: std::atomic is not value-initialized by std::array */
+    for (std::atomic<long>& count : mEventCounts) {
+        count = 0;
+    }
 }
 
 MonitoringState
@@ -52,6 +238,74 @@ AbstractObservableStateAdapter::switchState(const MonitoringState stateId)
     mReader->switchState(stateId);
 }
 
+void
+AbstractObservableStateAdapter::onEvent(const InternalEvent event)
+{
+    KEYPLE_SERVICE_TRACE(
+        mLogger,
+        "Internal event [%] received for reader [%] in current state [%]\n",
+        event,
+        mReader->getName(),
+        mMonitoringState);
+
+    mEventCounts[static_cast<std::size_t>(event)].fetch_add(
+        1, std::memory_order_relaxed);
+
+    const Transition& transition = TRANSITIONS[static_cast<std::size_t>(
+        mMonitoringState)][static_cast<std::size_t>(event)];
+
+    switch (transition.action) {
+    case TransitionAction::DROP_EVENT:
+        KEYPLE_SERVICE_TRACE(mLogger, "Event ignored\n");
+        return;
+
+    case TransitionAction::PROCESS_CARD_INSERTED: {
+        /* Process default selection if any, return an event, can be null */
+        const std::shared_ptr<CardReaderEvent> cardEvent
+            = mReader->processCardInserted();
+        if (cardEvent != nullptr) {
+            /* Switch internal state */
+            switchState(transition.repeatingState);
+            /* Notify the external observer of the event */
+            mReader->notifyObservers(cardEvent);
+        } else {
+            /*
+             * If none event was sent to the application, back to card
+             * detection once the card is removed
+             */
+            KEYPLE_SERVICE_TRACE(mLogger, "Inserted card hasn't matched\n");
+            switchState(MonitoringState::WAIT_FOR_CARD_REMOVAL);
+        }
+        return;
+    }
+
+    case TransitionAction::PROCESS_TIME_OUT:
+        mReader->processCardProcessingTimeout();
+        break;
+
+    case TransitionAction::SWITCH:
+        break;
+    }
+
+    if (mReader->getDetectionMode() == DetectionMode::REPEATING) {
+        if (transition.repeatingCardRemoved) {
+            mReader->processCardRemoved();
+        }
+        switchState(transition.repeatingState);
+    } else {
+        if (transition.singleShotCardRemoved) {
+            mReader->processCardRemoved();
+        }
+        switchState(transition.singleShotState);
+    }
+}
+
+long
+AbstractObservableStateAdapter::getEventCount(const InternalEvent event) const
+{
+    return mEventCounts[static_cast<std::size_t>(event)];
+}
+
 void
 AbstractObservableStateAdapter::onActivate()
 {
@@ -66,19 +320,25 @@ AbstractObservableStateAdapter::onActivate()
     }
 }
 
-void
+std::shared_ptr<JobFuture>
 AbstractObservableStateAdapter::onDeactivate()
 {
+    /*
+     * Release the handle in any case: the job references this state.
+     */
+    const std::shared_ptr<JobFuture> monitoringEvent = mMonitoringEvent;
+    mMonitoringEvent = nullptr;
+
     /* Cancel the monitoringJob if necessary */
-    if (mMonitoringEvent != nullptr && !mMonitoringEvent->isDone()) {
-        mMonitoringJob->stop();
-        mMonitoringEvent->cancel(false);
-
-        /*
-         * Make sure pointer is set to nullptr to force Job/Thread destruction.
-         */
-        mMonitoringEvent = nullptr;
+    if (monitoringEvent == nullptr || monitoringEvent->isDone()) {
+        return nullptr;
     }
+
+    /* Cancelled first so that a job woken up by stop() drops its event */
+    monitoringEvent->cancel(true);
+    mMonitoringJob->stop();
+
+    return monitoringEvent;
 }
 
 } /* namespace service */
@@ -17,22 +17,28 @@
 #include <string>
 #include <vector>
 
+#include "keyple/core/service/SmartCardServiceAdapter.hpp"
 #include "keyple/core/util/KeypleAssert.hpp"
 #include "keyple/core/util/cpp/System.hpp"
 #include "keyple/core/util/cpp/exception/Exception.hpp"
 #include "keyple/core/util/cpp/exception/IllegalStateException.hpp"
 #include "keypop/card/CardBrokenCommunicationException.hpp"
+#include "keypop/card/ReaderBrokenCommunicationException.hpp"
 #include "keypop/card/UnexpectedStatusWordException.hpp"
 
+#include "cpp/HotPathLog.hpp"
+
 namespace keyple {
 namespace core {
 namespace service {
 
+using keyple::core::service::cpp::MonitoringThreadPool;
 using keyple::core::util::Assert;
 using keyple::core::util::cpp::System;
 using keyple::core::util::cpp::exception::Exception;
 using keyple::core::util::cpp::exception::IllegalStateException;
 using keypop::card::CardBrokenCommunicationException;
+using keypop::card::ReaderBrokenCommunicationException;
 using keypop::card::UnexpectedStatusWordException;
 
 AbstractReaderAdapter::AbstractReaderAdapter(
@@ -63,18 +69,18 @@ AbstractReaderAdapter::transmitCardSelectionRequests(
 {
     checkStatus();
 
+    const std::lock_guard<std::recursive_mutex> lock(mTransmissionMutex);
+
     std::vector<std::shared_ptr<CardSelectionResponseApi>>
         cardSelectionResponses;
 
-    uint64_t timeStamp = System::nanoTime();
-    uint64_t elapsed10ms = (timeStamp - mBefore) / 100000;
-    mBefore = timeStamp;
-
-    mLogger->trace(
+    double elapsedMs = updateElapsedMs();
+    KEYPLE_SERVICE_TRACE(
+        mLogger,
         "Reader [%] --> cardSelectionRequests: %, elapsed % ms\n",
         getName(),
         cardSelectionRequests,
-        elapsed10ms / 10.0);
+        elapsedMs);
 
     try {
         cardSelectionResponses = processCardSelectionRequests(
@@ -90,15 +96,13 @@ AbstractReaderAdapter::transmitCardSelectionRequests(
             std::make_shared<UnexpectedStatusWordException>(e));
     }
 
-    timeStamp = System::nanoTime();
-    elapsed10ms = (timeStamp - mBefore) / 100000;
-    mBefore = timeStamp;
-
-    mLogger->trace(
+    elapsedMs = updateElapsedMs();
+    KEYPLE_SERVICE_TRACE(
+        mLogger,
         "Reader [%] <-- cardSelectionResponses: %, elapsed % ms\n",
         getName(),
         cardSelectionResponses,
-        elapsed10ms / 10.0);
+        elapsedMs);
 
     return cardSelectionResponses;
 }
@@ -121,9 +125,48 @@ AbstractReaderAdapter::doRegister()
 void
 AbstractReaderAdapter::doUnregister()
 {
+    shutdownIoWorker();
+
     mIsRegistered = false;
 }
 
+void
+AbstractReaderAdapter::shutdownIoWorker()
+{
+    std::shared_ptr<ExecutorService> ioWorker;
+    {
+        const std::lock_guard<std::mutex> lock(mIoWorkerMutex);
+        ioWorker.swap(mIoWorker);
+    }
+
+    if (ioWorker != nullptr) {
+        ioWorker->shutdown();
+    }
+}
+
+std::recursive_mutex&
+AbstractReaderAdapter::getTransmissionMutex()
+{
+    return mTransmissionMutex;
+}
+
+std::shared_ptr<ExecutorService>
+AbstractReaderAdapter::getIoWorker()
+{
+    const std::lock_guard<std::mutex> lock(mIoWorkerMutex);
+
+    if (mIoWorker == nullptr) {
+        const std::shared_ptr<MonitoringThreadPool> threadPool
+            = SmartCardServiceAdapter::getInstance()->getCardIoThreadPool();
+
+        mIoWorker = threadPool != nullptr
+                        ? std::make_shared<ExecutorService>(threadPool)
+                        : std::make_shared<ExecutorService>();
+    }
+
+    return mIoWorker;
+}
+
 const std::string&
 AbstractReaderAdapter::getName() const
 {
@@ -145,50 +188,178 @@ const std::shared_ptr<CardResponseApi>
 AbstractReaderAdapter::transmitCardRequest(
     const std::shared_ptr<CardRequestSpi> cardRequest,
     const ChannelControl channelControl)
+{
+    return tryTransmitCardRequest(cardRequest, channelControl)
+        .getCardResponseOrThrow();
+}
+
+CardRequestResult
+AbstractReaderAdapter::tryTransmitCardRequest(
+    const std::shared_ptr<CardRequestSpi> cardRequest,
+    const ChannelControl channelControl)
 {
     checkStatus();
 
     Assert::getInstance().notNull(cardRequest, "cardRequest");
 
-    std::shared_ptr<CardResponseApi> cardResponse = nullptr;
-
-    uint64_t timeStamp = System::nanoTime();
-    uint64_t elapsed10ms = (timeStamp - mBefore) / 100000;
-    mBefore = timeStamp;
+    const std::lock_guard<std::recursive_mutex> lock(mTransmissionMutex);
 
-    mLogger->trace(
+    double elapsedMs = updateElapsedMs();
+    KEYPLE_SERVICE_TRACE(
+        mLogger,
         "Reader [%] --> cardRequest: %, elapsed % ms\n",
         getName(),
         cardRequest,
-        elapsed10ms / 10.0);
+        elapsedMs);
 
-    try {
-        cardResponse = processCardRequest(cardRequest, channelControl);
-    } catch (const Exception& e) {
-        /* Finally block in Java */
-        (void)e;
-        timeStamp = System::nanoTime();
-        elapsed10ms = (timeStamp - mBefore) / 100000;
-        mBefore = timeStamp;
-        mLogger->trace(
+    const CardRequestResult cardRequestResult
+        = tryProcessCardRequest(cardRequest, channelControl);
+
+    elapsedMs = updateElapsedMs();
+    if (cardRequestResult.isSuccessful()) {
+        KEYPLE_SERVICE_DEBUG(
+            mLogger,
+            "[%] receive => %, elapsed % ms\n",
+            getName(),
+            cardRequestResult.getCardResponse(),
+            elapsedMs);
+    } else {
+        KEYPLE_SERVICE_TRACE(
+            mLogger,
             "Reader [%] <-- cardResponse: %, elapsed % ms\n",
             getName(),
-            cardResponse,
-            elapsed10ms / 10.0);
-        throw;
+            cardRequestResult.getCardResponse(),
+            elapsedMs);
+    }
+
+    return cardRequestResult;
+}
+
+CardRequestResult
+AbstractReaderAdapter::tryProcessCardRequest(
+    const std::shared_ptr<CardRequestSpi> cardRequest,
+    const ChannelControl channelControl)
+{
+    try {
+        return CardRequestResult(
+            processCardRequest(cardRequest, channelControl));
+    } catch (const UnexpectedStatusWordException& e) {
+        return CardRequestResult(
+            CardRequestResult::Status::UNEXPECTED_STATUS_WORD,
+            e.getCardResponse(),
+            e.isCardResponseComplete(),
+            e.getMessage(),
+            nullptr);
+    } catch (const ReaderBrokenCommunicationException& e) {
+        return CardRequestResult(
+            CardRequestResult::Status::READER_COMMUNICATION_FAILURE,
+            e.getCardResponse(),
+            e.isCardResponseComplete(),
+            e.getMessage(),
+            e.getCause());
+    } catch (const CardBrokenCommunicationException& e) {
+        return CardRequestResult(
+            CardRequestResult::Status::CARD_COMMUNICATION_FAILURE,
+            e.getCardResponse(),
+            e.isCardResponseComplete(),
+            e.getMessage(),
+            e.getCause());
+    }
+}
+
+std::future<std::shared_ptr<CardResponseApi>>
+AbstractReaderAdapter::transmitCardRequestAsync(
+    const std::shared_ptr<CardRequestSpi> cardRequest,
+    const ChannelControl channelControl)
+{
+    checkStatus();
+
+    Assert::getInstance().notNull(cardRequest, "cardRequest");
+
+    /* C++11: no move capture, the promise is shared with the task */
+    auto promise
+        = std::make_shared<std::promise<std::shared_ptr<CardResponseApi>>>();
+    std::future<std::shared_ptr<CardResponseApi>> future
+        = promise->get_future();
+
+    /* The queued request must not keep the reader alive */
+    const std::weak_ptr<AbstractReaderAdapter> weakReader = shared_from_this();
+
+    getIoWorker()->execute(
+        [weakReader, promise, cardRequest, channelControl]() {
+            try {
+                const std::shared_ptr<AbstractReaderAdapter> reader
+                    = getReaderOrThrow(weakReader);
+                promise->set_value(
+                    reader->transmitCardRequest(cardRequest, channelControl));
+            } catch (...) {
+                promise->set_exception(std::current_exception());
+            }
+        });
+
+    return future;
+}
+
+std::future<std::vector<std::shared_ptr<CardSelectionResponseApi>>>
+AbstractReaderAdapter::transmitCardSelectionRequestsAsync(
+    const std::vector<std::shared_ptr<CardSelectorBase>>& cardSelectors,
+    const std::vector<std::shared_ptr<CardSelectionRequestSpi>>&
+        cardSelectionRequests,
+    const MultiSelectionProcessing multiSelectionProcessing,
+    const ChannelControl channelControl)
+{
+    checkStatus();
+
+    auto promise = std::make_shared<
+        std::promise<std::vector<std::shared_ptr<CardSelectionResponseApi>>>>();
+    std::future<std::vector<std::shared_ptr<CardSelectionResponseApi>>> future
+        = promise->get_future();
+
+    const std::weak_ptr<AbstractReaderAdapter> weakReader = shared_from_this();
+
+    getIoWorker()->execute([weakReader,
+                            promise,
+                            cardSelectors,
+                            cardSelectionRequests,
+                            multiSelectionProcessing,
+                            channelControl]() {
+        try {
+            const std::shared_ptr<AbstractReaderAdapter> reader
+                = getReaderOrThrow(weakReader);
+            promise->set_value(reader->transmitCardSelectionRequests(
+                cardSelectors,
+                cardSelectionRequests,
+                multiSelectionProcessing,
+                channelControl));
+        } catch (...) {
+            promise->set_exception(std::current_exception());
+        }
+    });
+
+    return future;
+}
+
+std::shared_ptr<AbstractReaderAdapter>
+AbstractReaderAdapter::getReaderOrThrow(
+    const std::weak_ptr<AbstractReaderAdapter>& weakReader)
+{
+    const std::shared_ptr<AbstractReaderAdapter> reader = weakReader.lock();
+    if (reader == nullptr) {
+        throw IllegalStateException(
+            "The reader has been released before processing the request");
     }
 
-    /* Finally block in Java */
-    timeStamp = System::nanoTime();
-    elapsed10ms = (timeStamp - mBefore) / 100000;
+    return reader;
+}
+
+double
+AbstractReaderAdapter::updateElapsedMs()
+{
+    const uint64_t timeStamp = System::nanoTime();
+    const uint64_t elapsed10ms = (timeStamp - mBefore) / 100000;
     mBefore = timeStamp;
-    mLogger->debug(
-        "[%] receive => %, elapsed % ms\n",
-        getName(),
-        cardResponse,
-        elapsed10ms / 10.0);
 
-    return cardResponse;
+    return elapsed10ms / 10.0;
 }
 
 } /* namespace service */
@@ -14,6 +14,7 @@
 #include "keyple/core/service/ApduResponseAdapter.hpp"
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "keyple/core/util/cpp/Arrays.hpp"
@@ -30,6 +31,17 @@ ApduResponseAdapter::ApduResponseAdapter(const std::vector<uint8_t>& apdu)
 , mStatusWord(
       ((apdu[apdu.size() - 2] & 0x000000FF) << 8)
       + (apdu[apdu.size() - 1] & 0x000000FF))
+, mExtraRoundTripCount(0)
+{
+}
+
+ApduResponseAdapter::ApduResponseAdapter(
+    std::vector<uint8_t>&& apdu, const int extraRoundTripCount)
+: mApdu(std::move(apdu))
+, mStatusWord(
+      ((mApdu[mApdu.size() - 2] & 0x000000FF) << 8)
+      + (mApdu[mApdu.size() - 1] & 0x000000FF))
+, mExtraRoundTripCount(extraRoundTripCount)
 {
 }
 
@@ -51,6 +63,12 @@ ApduResponseAdapter::getStatusWord() const
     return mStatusWord;
 }
 
+int
+ApduResponseAdapter::getExtraRoundTripCount() const
+{
+    return mExtraRoundTripCount;
+}
+
 std::ostream&
 operator<<(std::ostream& os, const ApduResponseAdapter& ara)
 {
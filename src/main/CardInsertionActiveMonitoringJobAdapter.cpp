@@ -15,14 +15,12 @@
 
 #include <memory>
 
-#include "keyple/core/util/cpp/exception/InterruptedException.hpp"
 #include "keyple/core/util/cpp/exception/RuntimeException.hpp"
 
 namespace keyple {
 namespace core {
 namespace service {
 
-using keyple::core::util::cpp::exception::InterruptedException;
 using keyple::core::util::cpp::exception::RuntimeException;
 
 using InternalEvent = ObservableLocalReaderAdapter::InternalEvent;
@@ -32,10 +30,11 @@ using InternalEvent = ObservableLocalReaderAdapter::InternalEvent;
 
 CardInsertionActiveMonitoringJobAdapter::CardInsertionActiveMonitoringJob ::
     CardInsertionActiveMonitoringJob(
-        std::shared_ptr<AbstractObservableStateAdapter> monitoringState,
         CardInsertionActiveMonitoringJobAdapter* parent)
-: Job("CardInsertionActiveMonitoringJobAdapter - " + parent->mReader->getName())
-, mMonitoringState(monitoringState)
+: PollingJob(
+    "CardInsertionActiveMonitoringJobAdapter - " + parent->mReader->getName(),
+    parent->mExecutorService,
+    parent->mTimerWheel)
 , mParent(parent)
 {
 }
@@ -43,47 +42,42 @@ CardInsertionActiveMonitoringJobAdapter::CardInsertionActiveMonitoringJob ::
 void
 CardInsertionActiveMonitoringJobAdapter::CardInsertionActiveMonitoringJob::
     execute()
+{
+    mParent->mLogger->trace(
+        "Start monitoring job polling process using 'isCardPresent()' "
+        "method on reader [%]\n",
+        mParent->mReader->getName());
+
+    poll();
+}
+
+bool
+CardInsertionActiveMonitoringJobAdapter::CardInsertionActiveMonitoringJob::
+    pollOnce()
 {
     try {
-        mParent->mLogger->trace(
-            "Start monitoring job polling process using 'isCardPresent()' "
-            "method on reader [%]\n",
-            mParent->mReader->getName());
-
-        /* Re-init loop value to true */
-        mParent->mLoop = true;
-
-        while (mParent->mLoop) {
-            /* Polls for CARD_INSERTED */
-            if (mParent->mMonitorInsertion
-                && mParent->mReader->isCardPresent()) {
+        /* Polls for CARD_INSERTED */
+        if (mParent->mMonitorInsertion && mParent->mReader->isCardPresent()) {
+            if (endPolling()) {
                 mParent->mLogger->trace("Card present\n");
-                mMonitoringState->onEvent(InternalEvent::CARD_INSERTED);
-                return;
+                mParent->getReader()->recordCardDetection();
+                mParent->getReader()->onEvent(InternalEvent::CARD_INSERTED);
             }
+            return false;
+        }
 
-            /* Polls for CARD_REMOVED */
-            if (!mParent->mMonitorInsertion
-                && !mParent->mReader->isCardPresent()) {
+        /* Polls for CARD_REMOVED */
+        if (!mParent->mMonitorInsertion
+            && !mParent->mReader->isCardPresent()) {
+            if (endPolling()) {
                 mParent->mLogger->trace("Card not present\n");
-                mParent->mLoop = false;
-                mMonitoringState->onEvent(InternalEvent::CARD_REMOVED);
-                return;
-            }
-
-            /* Wait a bit */
-            try {
-                Thread::sleep(mParent->mSleepDurationMillis);
-            } catch (const InterruptedException& ignored) {
-                (void)ignored;
-                /* Restore interrupted state... */
-                interrupt();
-                mParent->mLoop = false;
+                mParent->getReader()->onEvent(InternalEvent::CARD_REMOVED);
             }
+            return false;
         }
-        mParent->mLogger->trace("Monitoring job polling process stopped");
 
     } catch (const RuntimeException& e) {
+        endPolling();
         dynamic_cast<ObservableLocalReaderAdapter*>(mParent->mReader)
             ->getObservationExceptionHandler()
             ->onReaderObservationError(
@@ -91,7 +85,29 @@ CardInsertionActiveMonitoringJobAdapter::CardInsertionActiveMonitoringJob::
                     ->getPluginName(),
                 mParent->mReader->getName(),
                 std::make_shared<RuntimeException>(e));
+        return false;
     }
+
+    return true;
+}
+
+long
+CardInsertionActiveMonitoringJobAdapter::CardInsertionActiveMonitoringJob::
+    getNextPollDelay(const int pollCount)
+{
+    return mParent->getReader()->getNextPollDelay(
+        mParent->mMonitorInsertion,
+        pollCount,
+        static_cast<long>(mParent->mSleepDurationMillis));
+}
+
+void
+CardInsertionActiveMonitoringJobAdapter::CardInsertionActiveMonitoringJob::
+    stop()
+{
+    stopPolling();
+
+    mParent->mLogger->trace("Monitoring job polling process stopped\n");
 }
 
 /* CARD INSERTION ACTIVE MONITORING JOB ADAPTER
@@ -101,26 +117,40 @@ CardInsertionActiveMonitoringJobAdapter::
     CardInsertionActiveMonitoringJobAdapter(
         ObservableLocalReaderAdapter* reader,
         const int64_t sleepDurationMillis,
-        const bool monitorInsertion)
+        const bool monitorInsertion,
+        std::shared_ptr<ExecutorService> executorService,
+        std::shared_ptr<TimerWheel> timerWheel)
 : AbstractMonitoringJobAdapter(reader)
 , mSleepDurationMillis(sleepDurationMillis)
 , mMonitorInsertion(monitorInsertion)
 , mReader(reader)
+, mExecutorService(executorService)
+, mTimerWheel(timerWheel)
 {
 }
 
 std::shared_ptr<Job>
 CardInsertionActiveMonitoringJobAdapter::getMonitoringJob(
-    const std::shared_ptr<AbstractObservableStateAdapter> monitoringState)
+    const std::shared_ptr<AbstractObservableStateAdapter> /*monitoringState*/)
 {
-    return std::make_shared<CardInsertionActiveMonitoringJob>(
-        monitoringState, this);
+    const auto monitoringJob
+        = std::make_shared<CardInsertionActiveMonitoringJob>(this);
+
+    const std::lock_guard<std::mutex> lock(mMutex);
+    mMonitoringJob = monitoringJob;
+
+    return monitoringJob;
 }
 
 void
 CardInsertionActiveMonitoringJobAdapter::stop()
 {
-    mLoop = false;
+    const std::lock_guard<std::mutex> lock(mMutex);
+
+    const auto monitoringJob = mMonitoringJob.lock();
+    if (monitoringJob != nullptr) {
+        monitoringJob->stop();
+    }
 }
 
 } /* namespace service */
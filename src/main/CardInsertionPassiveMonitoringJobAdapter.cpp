@@ -40,14 +40,19 @@ using InternalEvent = ObservableLocalReaderAdapter::InternalEvent;
 
 CardInsertionPassiveMonitoringJobAdapter::CardInsertionPassiveMonitoringJob ::
     CardInsertionPassiveMonitoringJob(
-        std::shared_ptr<AbstractObservableStateAdapter> monitoringState,
         CardInsertionPassiveMonitoringJobAdapter* parent)
 : Job("CardInsertionPassiveMonitoringJob")
-, mMonitoringState(monitoringState)
 , mParent(parent)
 {
 }
 
+bool
+CardInsertionPassiveMonitoringJobAdapter::CardInsertionPassiveMonitoringJob::
+    isBlocking() const
+{
+    return true;
+}
+
 void
 CardInsertionPassiveMonitoringJobAdapter::CardInsertionPassiveMonitoringJob::
     execute()
@@ -68,7 +73,12 @@ CardInsertionPassiveMonitoringJobAdapter::CardInsertionPassiveMonitoringJob::
         } else if (waitForCard != nullptr) {
             waitForCard->waitForCardInsertion();
         }
-        mMonitoringState->onEvent(InternalEvent::CARD_INSERTED);
+
+        /* Ignore a card inserted while the job was being stopped */
+        if (!getCancellationToken()->isCancellationRequested()) {
+            mParent->getReader()->recordCardDetection();
+            mParent->getReader()->onEvent(InternalEvent::CARD_INSERTED);
+        }
 
     } catch (const ReaderIOException& e) {
         /* Just warn as it can be a disconnection of the reader. */
@@ -105,10 +115,9 @@ CardInsertionPassiveMonitoringJobAdapter::
 
 std::shared_ptr<Job>
 CardInsertionPassiveMonitoringJobAdapter::getMonitoringJob(
-    std::shared_ptr<AbstractObservableStateAdapter> monitoringState)
+    std::shared_ptr<AbstractObservableStateAdapter> /*monitoringState*/)
 {
-    return std::make_shared<CardInsertionPassiveMonitoringJob>(
-        monitoringState, this);
+    return std::make_shared<CardInsertionPassiveMonitoringJob>(this);
 }
 
 void
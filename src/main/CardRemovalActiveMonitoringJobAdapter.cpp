@@ -18,8 +18,6 @@
 #include "keyple/core/plugin/ReaderIOException.hpp"
 #include "keyple/core/plugin/TaskCanceledException.hpp"
 #include "keyple/core/service/ObservableLocalReaderAdapter.hpp"
-#include "keyple/core/util/cpp/Thread.hpp"
-#include "keyple/core/util/cpp/exception/InterruptedException.hpp"
 #include "keyple/core/util/cpp/exception/RuntimeException.hpp"
 
 namespace keyple {
@@ -27,7 +25,6 @@ namespace core {
 namespace service {
 
 using InternalEvent = ObservableLocalReaderAdapter::InternalEvent;
-using keyple::core::util::cpp::exception::InterruptedException;
 using keyple::core::util::cpp::exception::RuntimeException;
 
 /* CARD REMOVAL ACTIVE MONITORING JOB
@@ -35,44 +32,42 @@ using keyple::core::util::cpp::exception::RuntimeException;
 
 CardRemovalActiveMonitoringJobAdapter::CardRemovalActiveMonitoringJob ::
     CardRemovalActiveMonitoringJob(
-        std::shared_ptr<AbstractObservableStateAdapter> monitoringState,
         CardRemovalActiveMonitoringJobAdapter* parent)
-: Job("CardRemovalActiveMonitoringJobAdapter")
-, mMonitoringState(monitoringState)
+: PollingJob(
+    "CardRemovalActiveMonitoringJobAdapter",
+    parent->mExecutorService,
+    parent->mTimerWheel)
 , mParent(parent)
 {
 }
 
 void
 CardRemovalActiveMonitoringJobAdapter::CardRemovalActiveMonitoringJob::execute()
+{
+    mParent->mLogger->trace(
+        "Start monitoring job polling process using 'isCardPresentPing()'"
+        "method on reader [%]\n",
+        mParent->getReader()->getName());
+
+    poll();
+}
+
+bool
+CardRemovalActiveMonitoringJobAdapter::CardRemovalActiveMonitoringJob::
+    pollOnce()
 {
     try {
-        mParent->mLogger->trace(
-            "Start monitoring job polling process using 'isCardPresentPing()'"
-            "method on reader [%]\n",
-            mParent->getReader()->getName());
-
-        /* Re-init loop value to true */
-        mParent->mLoop = true;
-
-        while (mParent->mLoop) {
-            if (!mParent->getReader()->isCardPresentPing()) {
-                mParent->mLogger->trace("Card stop responding\n");
-                break;
-            }
+        if (!mParent->getReader()->isCardPresentPing()) {
+            mParent->mLogger->trace("Card stop responding\n");
 
-            /* Wait a bit */
-            try {
-                Thread::sleep(mParent->mSleepDurationMillis);
-            } catch (const InterruptedException& ignored) {
-                (void)ignored;
-                /* Restore interrupted state... */
-                interrupt();
-                mParent->mLoop = false;
+            if (endPolling()) {
+                mParent->mLogger->trace(
+                    "Monitoring job polling process stopped\n");
+                mParent->getReader()->onEvent(InternalEvent::CARD_REMOVED);
             }
+            return false;
         }
 
-        mParent->mLogger->trace("Monitoring job polling process stopped\n");
     } catch (const RuntimeException& e) {
         mParent->getReader()
             ->getObservationExceptionHandler()
@@ -80,36 +75,71 @@ CardRemovalActiveMonitoringJobAdapter::CardRemovalActiveMonitoringJob::execute()
                 mParent->getReader()->getPluginName(),
                 mParent->getReader()->getName(),
                 std::make_shared<RuntimeException>(e));
+
+        if (endPolling()) {
+            mParent->getReader()->onEvent(InternalEvent::CARD_REMOVED);
+        }
+        return false;
     }
 
-    /* Finally block */
-    mMonitoringState->onEvent(InternalEvent::CARD_REMOVED);
+    return true;
+}
+
+long
+CardRemovalActiveMonitoringJobAdapter::CardRemovalActiveMonitoringJob::
+    getNextPollDelay(const int pollCount)
+{
+    return mParent->getReader()->getNextPollDelay(
+        false, pollCount, static_cast<long>(mParent->mSleepDurationMillis));
+}
+
+void
+CardRemovalActiveMonitoringJobAdapter::CardRemovalActiveMonitoringJob::stop()
+{
+    stopPolling();
+
+    mParent->mLogger->trace("Monitoring job polling process stopped\n");
 }
 
 /* CARD REMOVAL ACTIVE MONITORING JOB ADAPTER
  * --------------------------------------------------- */
 
 CardRemovalActiveMonitoringJobAdapter::CardRemovalActiveMonitoringJobAdapter(
-    ObservableLocalReaderAdapter* reader, const int64_t sleepDurationMillis)
+    ObservableLocalReaderAdapter* reader,
+    const int64_t sleepDurationMillis,
+    std::shared_ptr<ExecutorService> executorService,
+    std::shared_ptr<TimerWheel> timerWheel)
 : AbstractMonitoringJobAdapter(reader)
 , mReaderSpi(std::dynamic_pointer_cast<WaitForCardRemovalBlockingSpi>(
       reader->getObservableReaderSpi()))
 , mSleepDurationMillis(sleepDurationMillis)
+, mExecutorService(executorService)
+, mTimerWheel(timerWheel)
 {
 }
 
 std::shared_ptr<Job>
 CardRemovalActiveMonitoringJobAdapter::getMonitoringJob(
-    std::shared_ptr<AbstractObservableStateAdapter> monitoringState)
+    std::shared_ptr<AbstractObservableStateAdapter> /*monitoringState*/)
 {
-    return std::make_shared<CardRemovalActiveMonitoringJob>(
-        monitoringState, this);
+    const auto monitoringJob
+        = std::make_shared<CardRemovalActiveMonitoringJob>(this);
+
+    const std::lock_guard<std::mutex> lock(mMutex);
+    mMonitoringJob = monitoringJob;
+
+    return monitoringJob;
 }
 
 void
 CardRemovalActiveMonitoringJobAdapter::stop()
 {
-    mLoop = false;
+    const std::lock_guard<std::mutex> lock(mMutex);
+
+    const auto monitoringJob = mMonitoringJob.lock();
+    if (monitoringJob != nullptr) {
+        monitoringJob->stop();
+    }
 }
 
 } /* namespace service */
@@ -47,14 +47,19 @@ using InternalEvent = ObservableLocalReaderAdapter::InternalEvent;
 
 CardRemovalPassiveMonitoringJobAdapter::CardRemovalPassiveMonitoringJob ::
     CardRemovalPassiveMonitoringJob(
-        std::shared_ptr<AbstractObservableStateAdapter> monitoringState,
         CardRemovalPassiveMonitoringJobAdapter* parent)
 : Job("CardRemovalPassiveMonitoringJobAdapter")
-, mMonitoringState(monitoringState)
 , mParent(parent)
 {
 }
 
+bool
+CardRemovalPassiveMonitoringJobAdapter::CardRemovalPassiveMonitoringJob::
+    isBlocking() const
+{
+    return true;
+}
+
 void
 CardRemovalPassiveMonitoringJobAdapter::CardRemovalPassiveMonitoringJob::
     execute()
@@ -103,8 +108,10 @@ CardRemovalPassiveMonitoringJobAdapter::CardRemovalPassiveMonitoringJob::
                 std::make_shared<RuntimeException>(e));
     }
 
-    /* Finally */
-    mMonitoringState->onEvent(InternalEvent::CARD_REMOVED);
+    /* Finally, unless the job has been stopped by a state switch */
+    if (!getCancellationToken()->isCancellationRequested()) {
+        mParent->getReader()->onEvent(InternalEvent::CARD_REMOVED);
+    }
 }
 
 /* CARD REMOVAL PASSIVE MONITORING JOB ADAPTER
@@ -119,10 +126,9 @@ CardRemovalPassiveMonitoringJobAdapter::CardRemovalPassiveMonitoringJobAdapter(
 
 std::shared_ptr<Job>
 CardRemovalPassiveMonitoringJobAdapter::getMonitoringJob(
-    std::shared_ptr<AbstractObservableStateAdapter> monitoringState)
+    std::shared_ptr<AbstractObservableStateAdapter> /*monitoringState*/)
 {
-    return std::make_shared<CardRemovalPassiveMonitoringJob>(
-        monitoringState, this);
+    return std::make_shared<CardRemovalPassiveMonitoringJob>(this);
 }
 
 void
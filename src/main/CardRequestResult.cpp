@@ -0,0 +1,108 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#include "keyple/core/service/CardRequestResult.hpp"
+
+#include "keypop/card/CardBrokenCommunicationException.hpp"
+#include "keypop/card/ReaderBrokenCommunicationException.hpp"
+#include "keypop/card/UnexpectedStatusWordException.hpp"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using keypop::card::CardBrokenCommunicationException;
+using keypop::card::ReaderBrokenCommunicationException;
+using keypop::card::UnexpectedStatusWordException;
+
+CardRequestResult::CardRequestResult(
+    const std::shared_ptr<CardResponseApi> cardResponse)
+: mStatus(Status::SUCCESS)
+, mCardResponse(cardResponse)
+, mIsCardResponseComplete(true)
+, mCause(nullptr)
+{
+}
+
+CardRequestResult::CardRequestResult(
+    const Status status,
+    const std::shared_ptr<CardResponseApi> cardResponse,
+    const bool isCardResponseComplete,
+    const std::string& message,
+    const std::shared_ptr<Exception> cause)
+: mStatus(status)
+, mCardResponse(cardResponse)
+, mIsCardResponseComplete(isCardResponseComplete)
+, mMessage(message)
+, mCause(cause)
+{
+}
+
+CardRequestResult::Status
+CardRequestResult::getStatus() const
+{
+    return mStatus;
+}
+
+bool
+CardRequestResult::isSuccessful() const
+{
+    return mStatus == Status::SUCCESS;
+}
+
+std::shared_ptr<CardResponseApi>
+CardRequestResult::getCardResponse() const
+{
+    return mCardResponse;
+}
+
+bool
+CardRequestResult::isCardResponseComplete() const
+{
+    return mIsCardResponseComplete;
+}
+
+const std::string&
+CardRequestResult::getMessage() const
+{
+    return mMessage;
+}
+
+std::shared_ptr<Exception>
+CardRequestResult::getCause() const
+{
+    return mCause;
+}
+
+std::shared_ptr<CardResponseApi>
+CardRequestResult::getCardResponseOrThrow() const
+{
+    switch (mStatus) {
+    case Status::SUCCESS:
+        return mCardResponse;
+    case Status::UNEXPECTED_STATUS_WORD:
+        throw UnexpectedStatusWordException(
+            mCardResponse, mIsCardResponseComplete, mMessage);
+    case Status::READER_COMMUNICATION_FAILURE:
+        throw ReaderBrokenCommunicationException(
+            mCardResponse, mIsCardResponseComplete, mMessage, mCause);
+    case Status::CARD_COMMUNICATION_FAILURE:
+    default:
+        throw CardBrokenCommunicationException(
+            mCardResponse, mIsCardResponseComplete, mMessage, mCause);
+    }
+}
+
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
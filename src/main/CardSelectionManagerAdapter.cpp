@@ -13,8 +13,14 @@
 
 #include "keyple/core/service/CardSelectionManagerAdapter.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <set>
 #include <string>
+#include <system_error>
+#include <thread>
 #include <vector>
 
 #include "keyple/core/service/AbstractReaderAdapter.hpp"
@@ -127,17 +133,24 @@ CardSelectionManagerAdapter::processCardSelectionScenario(
     Assert::getInstance().notNull(reader, "reader");
 
     /* Communicate with the card to make the actual selection */
-    std::vector<std::shared_ptr<CardSelectionResponseApi>>
-        cardSelectionResponses;
+    const std::vector<std::shared_ptr<CardSelectionResponseApi>>
+        cardSelectionResponses = transmitCardSelectionRequests(reader);
 
+    /* Analyze the received responses */
+    return processCardSelectionResponses(cardSelectionResponses);
+}
+
+std::vector<std::shared_ptr<CardSelectionResponseApi>>
+CardSelectionManagerAdapter::transmitCardSelectionRequests(
+    std::shared_ptr<CardReader> reader) const
+{
     try {
-        cardSelectionResponses
-            = std::dynamic_pointer_cast<AbstractReaderAdapter>(reader)
-                  ->transmitCardSelectionRequests(
-                      mCardSelectors,
-                      mCardSelectionRequests,
-                      mMultiSelectionProcessing,
-                      mChannelControl);
+        return std::dynamic_pointer_cast<AbstractReaderAdapter>(reader)
+            ->transmitCardSelectionRequests(
+                mCardSelectors,
+                mCardSelectionRequests,
+                mMultiSelectionProcessing,
+                mChannelControl);
     } catch (const ReaderBrokenCommunicationException& e) {
         throw ReaderCommunicationException(
             e.getMessage(),
@@ -147,9 +160,88 @@ CardSelectionManagerAdapter::processCardSelectionScenario(
             e.getMessage(),
             std::make_shared<CardBrokenCommunicationException>(e));
     }
+}
 
-    /* Analyze the received responses */
-    return processCardSelectionResponses(cardSelectionResponses);
+std::vector<std::shared_ptr<ParallelCardSelectionResult>>
+CardSelectionManagerAdapter::processCardSelectionScenarioInParallel(
+    const std::vector<std::shared_ptr<CardReader>>& readers,
+    const int maxParallelism)
+{
+    Assert::getInstance().greaterOrEqual(
+        maxParallelism, 1, "maxParallelism");
+    std::set<std::shared_ptr<CardReader>> distinctReaders;
+    for (const auto& reader : readers) {
+        Assert::getInstance().notNull(reader, "reader");
+        if (!distinctReaders.insert(reader).second) {
+            throw IllegalArgumentException(
+                "The reader " + reader->getName() + " is provided twice");
+        }
+    }
+
+    /* Filled by the workers, one slot per reader */
+    const std::size_t readerCount = readers.size();
+    std::vector<std::vector<std::shared_ptr<CardSelectionResponseApi>>>
+        responses(readerCount);
+    std::vector<std::exception_ptr> exceptions(readerCount);
+    std::vector<long long> elapsedMicros(readerCount, 0);
+
+    std::atomic<std::size_t> nextIndex(0);
+    const auto worker = [&]() {
+        for (std::size_t i = nextIndex++; i < readerCount; i = nextIndex++) {
+            const auto start = std::chrono::steady_clock::now();
+            try {
+                responses[i] = transmitCardSelectionRequests(readers[i]);
+            } catch (...) {
+                exceptions[i] = std::current_exception();
+            }
+            elapsedMicros[i]
+                = std::chrono::duration_cast<std::chrono::microseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+        }
+    };
+
+    const std::size_t workerCount = std::min(
+        static_cast<std::size_t>(maxParallelism), readerCount);
+    std::vector<std::thread> workers;
+    try {
+        for (std::size_t i = 1; i < workerCount; i++) {
+            workers.emplace_back(worker);
+        }
+    } catch (const std::system_error& e) {
+        /* The workers already started and the calling thread share the work */
+        mLogger->warn(
+            "Only % of % selection worker(s) could be started: %\n",
+            workers.size() + 1,
+            workerCount,
+            e.what());
+    }
+
+    /* The calling thread is one of the workers */
+    worker();
+
+    for (auto& thread : workers) {
+        thread.join();
+    }
+
+    /* Analyze the received responses, on the calling thread only */
+    std::vector<std::shared_ptr<ParallelCardSelectionResult>> results;
+    for (std::size_t i = 0; i < readerCount; i++) {
+        std::shared_ptr<CardSelectionResult> cardSelectionResult = nullptr;
+        if (exceptions[i] == nullptr) {
+            try {
+                cardSelectionResult
+                    = parseCardSelectionResponses(responses[i]);
+            } catch (...) {
+                exceptions[i] = std::current_exception();
+            }
+        }
+
+        results.push_back(std::make_shared<ParallelCardSelectionResult>(
+            readers[i], cardSelectionResult, exceptions[i], elapsedMicros[i]));
+    }
+
+    return results;
 }
 
 void
@@ -215,6 +307,19 @@ const std::shared_ptr<CardSelectionResult>
 CardSelectionManagerAdapter::processCardSelectionResponses(
     const std::vector<std::shared_ptr<CardSelectionResponseApi>>&
         cardSelectionResponses)
+{
+    const std::shared_ptr<CardSelectionResult> cardSelectionsResult
+        = parseCardSelectionResponses(cardSelectionResponses);
+
+    mCardSelectionResponses = cardSelectionResponses;
+
+    return cardSelectionsResult;
+}
+
+const std::shared_ptr<CardSelectionResult>
+CardSelectionManagerAdapter::parseCardSelectionResponses(
+    const std::vector<std::shared_ptr<CardSelectionResponseApi>>&
+        cardSelectionResponses) const
 {
     Assert::getInstance().isInRange(
         cardSelectionResponses.size(),
@@ -256,8 +361,6 @@ CardSelectionManagerAdapter::processCardSelectionResponses(
         index++;
     }
 
-    mCardSelectionResponses = cardSelectionResponses;
-
     return cardSelectionsResult;
 }
 
@@ -0,0 +1,71 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#include "keyple/core/service/ExponentialBackoffPollingPolicy.hpp"
+
+#include "keyple/core/util/cpp/exception/IllegalArgumentException.hpp"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using keyple::core::util::cpp::exception::IllegalArgumentException;
+
+ExponentialBackoffPollingPolicy::ExponentialBackoffPollingPolicy(
+    const long initialDelayMillis,
+    const long maxDelayMillis,
+    const int pollsPerStep)
+: mInitialDelayMillis(initialDelayMillis)
+, mMaxDelayMillis(maxDelayMillis)
+, mPollsPerStep(pollsPerStep)
+{
+    if (initialDelayMillis < 1) {
+        throw IllegalArgumentException("initialDelayMillis must be positive");
+    }
+
+    if (maxDelayMillis < initialDelayMillis) {
+        throw IllegalArgumentException(
+            "maxDelayMillis must not be less than initialDelayMillis");
+    }
+
+    if (pollsPerStep < 1) {
+        throw IllegalArgumentException("pollsPerStep must be positive");
+    }
+}
+
+long
+ExponentialBackoffPollingPolicy::getNextPollDelay(
+    const bool monitorInsertion,
+    const int pollCount,
+    const long defaultDelayMillis)
+{
+    if (!monitorInsertion) {
+        return defaultDelayMillis;
+    }
+
+    long delayMillis = mInitialDelayMillis;
+
+    /* Doubled at each step, clamped before doubling to avoid an overflow */
+    for (int step = (pollCount - 1) / mPollsPerStep;
+         step > 0 && delayMillis < mMaxDelayMillis;
+         step--) {
+        delayMillis = delayMillis > mMaxDelayMillis / 2 ? mMaxDelayMillis
+                                                        : delayMillis * 2;
+    }
+
+    return delayMillis;
+}
+
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
@@ -40,6 +40,8 @@
 #include "keypop/reader/ReaderCommunicationException.hpp"
 #include "keypop/reader/ReaderProtocolNotSupportedException.hpp"
 
+#include "cpp/HotPathLog.hpp"
+
 namespace keyple {
 namespace core {
 namespace service {
@@ -72,6 +74,16 @@ const int LocalReaderAdapter::SW_6C00 = 0x6C00;
 const int LocalReaderAdapter::SW1_MASK = 0xFF00;
 const int LocalReaderAdapter::SW2_MASK = 0x00FF;
 
+const std::vector<int> LocalReaderAdapter::INTERNAL_SUCCESSFUL_STATUS_WORDS
+    = {0x9000};
+
+const std::string LocalReaderAdapter::GET_RESPONSE_INFO
+    = "Internal Get Response";
+
+const int LocalReaderAdapter::MAX_EXTRA_ROUND_TRIPS = 32;
+
+const std::size_t LocalReaderAdapter::TRANSACTION_ARENA_BLOCK_SIZE = 4096;
+
 LocalReaderAdapter::LocalReaderAdapter(
     std::shared_ptr<ReaderSpi> readerSpi, const std::string& pluginName)
 : AbstractReaderAdapter(
@@ -85,6 +97,8 @@ LocalReaderAdapter::LocalReaderAdapter(
 , mCurrentLogicalProtocolName("")
 , mCurrentPhysicalProtocolName("")
 , mProtocolAssociations({})
+, mTransactionArenaEnabled(false)
+, mApduTraceDumpOnFailureEnabled(false)
 {
 }
 
@@ -187,7 +201,8 @@ LocalReaderAdapter::processExplicitAidSelection(
 {
     const std::vector<uint8_t>& aid = cardSelector->getAid();
 
-    mLogger->debug(
+    KEYPLE_SERVICE_DEBUG(
+        mLogger,
         "Reader [%] selects application with AID [%]\n",
         getName(),
         HexUtil::toHex(aid));
@@ -215,11 +230,10 @@ LocalReaderAdapter::processExplicitAidSelection(
         aid, 0, selectApplicationCommand, 5, static_cast<int>(aid.size()));
     selectApplicationCommand[5 + aid.size()] = 0x00; /* Le */
 
-    auto apduRequest = std::shared_ptr<ApduRequest>(
-        new ApduRequest(selectApplicationCommand));
-    apduRequest->setInfo("Internal Select Application");
-
-    return processApduRequest(apduRequest);
+    return processApdu(
+        selectApplicationCommand,
+        INTERNAL_SUCCESSFUL_STATUS_WORDS,
+        "Internal Select Application");
 }
 
 std::shared_ptr<ApduResponseAdapter>
@@ -242,9 +256,10 @@ LocalReaderAdapter::selectByAid(
         const uint8_t p2 = computeSelectApplicationP2(
             cardSelector->getFileOccurrence(),
             cardSelector->getFileControlInformation());
-        const std::vector<uint8_t> selectionDataBytes
+        std::vector<uint8_t> selectionDataBytes
             = reader->openChannelForAid(aid, p2);
-        fciResponse = std::make_shared<ApduResponseAdapter>(selectionDataBytes);
+        fciResponse = makeResponse<ApduResponseAdapter>(
+            std::move(selectionDataBytes));
     } else {
         fciResponse = processExplicitAidSelection(cardSelector);
     }
@@ -262,7 +277,8 @@ LocalReaderAdapter::checkPowerOnData(
     /* Check the power-on data */
     if (powerOnData != "" && powerOnDataRegex != ""
         && !std::regex_match(powerOnData, std::regex(powerOnDataRegex))) {
-        mLogger->trace(
+        KEYPLE_SERVICE_TRACE(
+            mLogger,
             "Power-on data didn't match (powerOnData: %, powerOnDataRegex: %\n",
             getName(),
             powerOnDataRegex);
@@ -356,14 +372,14 @@ LocalReaderAdapter::processCardSelectionRequest(
         selectionStatus = processSelection(cardSelector, cardSelectionRequest);
     } catch (const ReaderIOException& e) {
         throw ReaderBrokenCommunicationException(
-            std::make_shared<CardResponseAdapter>(
+            makeResponse<CardResponseAdapter>(
                 std::vector<std::shared_ptr<ApduResponseApi>>({}), false),
             false,
             e.getMessage(),
             std::make_shared<ReaderIOException>(e));
     } catch (const CardIOException& e) {
         throw CardBrokenCommunicationException(
-            std::make_shared<CardResponseAdapter>(
+            makeResponse<CardResponseAdapter>(
                 std::vector<std::shared_ptr<ApduResponseApi>>({}), false),
             false,
             e.getMessage(),
@@ -373,11 +389,11 @@ LocalReaderAdapter::processCardSelectionRequest(
     if (!selectionStatus->mHasMatched) {
         /* The selection failed, return an empty response having the selection
          * status */
-        return std::make_shared<CardSelectionResponseAdapter>(
+        return makeResponse<CardSelectionResponseAdapter>(
             selectionStatus->mPowerOnData,
             selectionStatus->mSelectApplicationResponse,
             false,
-            std::make_shared<CardResponseAdapter>(
+            makeResponse<CardResponseAdapter>(
                 std::vector<std::shared_ptr<ApduResponseApi>>({}), false));
     }
 
@@ -386,13 +402,33 @@ LocalReaderAdapter::processCardSelectionRequest(
     std::shared_ptr<CardResponseAdapter> cardResponse = nullptr;
 
     if (cardSelectionRequest->getCardRequest() != nullptr) {
-        cardResponse
-            = processCardRequest(cardSelectionRequest->getCardRequest());
+        const CardRequestResult cardRequestResult
+            = tryProcessCardRequest(cardSelectionRequest->getCardRequest());
+
+        if (cardRequestResult.getStatus()
+            == CardRequestResult::Status::UNEXPECTED_STATUS_WORD) {
+            /*
+             * Reported as AbstractReaderAdapter does for the selection
+             * requests, without throwing the UnexpectedStatusWordException
+             * first
+             */
+            throw CardBrokenCommunicationException(
+                cardRequestResult.getCardResponse(),
+                false,
+                "An unexpected status word was received",
+                std::make_shared<UnexpectedStatusWordException>(
+                    cardRequestResult.getCardResponse(),
+                    cardRequestResult.isCardResponseComplete(),
+                    cardRequestResult.getMessage()));
+        }
+
+        cardResponse = std::static_pointer_cast<CardResponseAdapter>(
+            cardRequestResult.getCardResponseOrThrow());
     } else {
         cardResponse = nullptr;
     }
 
-    return std::make_shared<CardSelectionResponseAdapter>(
+    return makeResponse<CardSelectionResponseAdapter>(
         selectionStatus->mPowerOnData,
         selectionStatus->mSelectApplicationResponse,
         true,
@@ -403,120 +439,263 @@ std::shared_ptr<ApduResponseAdapter>
 LocalReaderAdapter::processApduRequest(
     const std::shared_ptr<ApduRequestSpi> apduRequest)
 {
-    std::shared_ptr<ApduResponseAdapter> apduResponse = nullptr;
-
-    uint64_t timeStamp = System::nanoTime();
-    uint64_t elapsed10ms = (timeStamp - mBefore) / 100000;
-    mBefore = timeStamp;
-
-    mLogger->debug(
-        "Reader [%] --> apduRequest: %, elapsed % ms\n",
-        getName(),
-        apduRequest,
-        elapsed10ms / 10.0);
+    /* C++: the only copy of the command, imposed by ApduRequestSpi */
+    std::vector<uint8_t> apdu = apduRequest->getApdu();
 
-    apduResponse = std::make_shared<ApduResponseAdapter>(
-        mReaderSpi->transmitApdu(apduRequest->getApdu()));
-
-    timeStamp = System::nanoTime();
-    elapsed10ms = (timeStamp - mBefore) / 100000;
-    mBefore = timeStamp;
+    return processApdu(
+        apdu, apduRequest->getSuccessfulStatusWords(), apduRequest->getInfo());
+}
 
-    mLogger->debug(
-        "Reader [%] <-- apduResponse: %, elapsed % ms\n",
-        getName(),
-        apduResponse,
-        elapsed10ms / 10.0);
+std::shared_ptr<ApduResponseAdapter>
+LocalReaderAdapter::processApdu(
+    std::vector<uint8_t>& apdu,
+    const std::vector<int>& successfulStatusWords,
+    const std::string& info)
+{
+    return completeApduResponse(
+        apdu, exchangeApdu(apdu, info), successfulStatusWords, info);
+}
 
-    if (apduResponse->getDataOut().size() == 0) {
-        if ((apduResponse->getStatusWord() & SW1_MASK) == SW_6100) {
+std::shared_ptr<ApduResponseAdapter>
+LocalReaderAdapter::completeApduResponse(
+    std::vector<uint8_t>& apdu,
+    std::vector<uint8_t>&& response,
+    const std::vector<int>& successfulStatusWords,
+    const std::string& info)
+{
+    /* Reused by all the GET RESPONSE commands of the chain */
+    std::vector<uint8_t> getResponseApdu = {0x00, 0xC0, 0x00, 0x00, 0x00};
+
+    std::vector<uint8_t>* command = &apdu;
+    const std::string* commandInfo = &info;
+
+    /* Data of the 61XX chunks, then the last response */
+    std::vector<uint8_t> completeResponse;
+    int extraRoundTripCount = 0;
+
+    /* Each continue transmits the updated command */
+    for (;; response = exchangeApdu(*command, *commandInfo)) {
+        const int statusWord = ((response[response.size() - 2] & 0xFF) << 8)
+                               + (response[response.size() - 1] & 0xFF);
+        const uint8_t sw2 = static_cast<uint8_t>(statusWord & SW2_MASK);
+        const bool hasDataOut = response.size() > 2;
+
+        if (extraRoundTripCount == MAX_EXTRA_ROUND_TRIPS) {
+            mLogger->warn(
+                "Reader [%] stops completing the response to [%] after % "
+                "extra round trips\n",
+                getName(),
+                info,
+                extraRoundTripCount);
+
+        } else if ((statusWord & SW1_MASK) == SW_6100) {
             /*
              * RL-SW-61XX.1
-             * Build a GetResponse APDU command with the provided "le"
+             * Keep the data received so far and build a GetResponse APDU
+             * command with the provided "le"
              */
-            const uint8_t le = apduResponse->getStatusWord() & SW2_MASK;
-            const std::vector<uint8_t> getResponseApdu
-                = {0x00, 0xC0, 0x00, 0x00, le};
+            if (completeResponse.empty()) {
+                completeResponse.reserve(
+                    response.size() + (sw2 == 0 ? 256 : sw2));
+            }
+            completeResponse.insert(
+                completeResponse.end(), response.begin(), response.end() - 2);
 
-            /* Execute APDU */
-            auto adapter = std::shared_ptr<ApduRequest>(
-                new ApduRequest(getResponseApdu));
-            adapter->setInfo("Internal Get Response");
-            apduResponse = processApduRequest(adapter);
+            getResponseApdu[4] = sw2;
+            command = &getResponseApdu;
+            commandInfo = &GET_RESPONSE_INFO;
+            extraRoundTripCount++;
+            continue;
 
-        } else if ((apduResponse->getStatusWord() & SW1_MASK) == SW_6C00) {
+        } else if (!hasDataOut && (statusWord & SW1_MASK) == SW_6C00) {
             /*
              * RL-SW-6CXX.1
-             * Update the last command with the provided "le"
+             * Update the last command with the provided "le" and replay it
              */
-            apduRequest->getApdu()[apduRequest->getApdu().size() - 1]
-                = (apduResponse->getStatusWord() & SW2_MASK);
-
-            /* Replay the last command APDU */
-            apduResponse = processApduRequest(apduRequest);
+            (*command)[command->size() - 1] = sw2;
+            extraRoundTripCount++;
+            continue;
 
         } else if (
-            ApduUtil::isCase4(apduRequest->getApdu())
-            && Arrays::contains(
-                apduRequest->getSuccessfulStatusWords(),
-                apduResponse->getStatusWord())) {
+            !hasDataOut && command == &apdu && ApduUtil::isCase4(apdu)
+            && Arrays::contains(successfulStatusWords, statusWord)) {
             /*
              * RL-SW-ANALYSIS.1
              * RL-SW-CASE4.1 (SW=6200 not taken into account here)
              * Build a GetResponse APDU command with the original "le"
              */
-            const uint8_t le
-                = apduRequest->getApdu()[apduRequest->getApdu().size() - 1];
-            const std::vector<uint8_t> getResponseApdu
-                = {0x00, 0xC0, 0x00, 0x00, le};
-
-            /* Execute GetResponse APDU */
-            auto adapter = std::shared_ptr<ApduRequest>(
-                new ApduRequest(getResponseApdu));
-            adapter->setInfo("Internal Get Response");
-            apduResponse = processApduRequest(adapter);
+            getResponseApdu[4] = apdu[apdu.size() - 1];
+            command = &getResponseApdu;
+            commandInfo = &GET_RESPONSE_INFO;
+            extraRoundTripCount++;
+            continue;
         }
+
+        if (completeResponse.empty()) {
+            completeResponse = std::move(response);
+        } else {
+            completeResponse.insert(
+                completeResponse.end(), response.begin(), response.end());
+        }
+        break;
     }
 
-    return apduResponse;
+    if (extraRoundTripCount > 0) {
+        KEYPLE_SERVICE_DEBUG(
+            mLogger,
+            "Reader [%] completed the response to [%] in % extra round "
+            "trip(s)\n",
+            getName(),
+            info,
+            extraRoundTripCount);
+    }
+
+    return makeResponse<ApduResponseAdapter>(
+        std::move(completeResponse), extraRoundTripCount);
 }
 
-std::shared_ptr<CardResponseAdapter>
-LocalReaderAdapter::processCardRequest(
+std::vector<uint8_t>
+LocalReaderAdapter::exchangeApdu(
+    const std::vector<uint8_t>& command, const std::string& info)
+{
+    const uint64_t timeStamp = System::nanoTime();
+
+    /* Logged before sending, so that a failed transmission is logged too */
+    KEYPLE_SERVICE_DEBUG(
+        mLogger,
+        "Reader [%] --> apduRequest: {APDU: %, INFO: %}, elapsed % ms\n",
+        getName(),
+        command,
+        info,
+        (timeStamp - mBefore) / 100000 / 10.0);
+
+    /* The response is moved to the caller */
+    std::vector<uint8_t> response;
+    try {
+        response = mReaderSpi->transmitApdu(command);
+    } catch (const Exception& e) {
+        (void)e;
+        mApduTrace.recordFailure(command, timeStamp, System::nanoTime());
+        if (mApduTraceDumpOnFailureEnabled) {
+            dumpApduTrace();
+        }
+        throw;
+    }
+
+    const uint64_t responseTimeStamp = System::nanoTime();
+    mApduTrace.record(command, response, timeStamp, responseTimeStamp);
+
+    KEYPLE_SERVICE_DEBUG(
+        mLogger,
+        "Reader [%] <-- apduResponse: %, elapsed % ms\n",
+        getName(),
+        response,
+        (responseTimeStamp - timeStamp) / 100000 / 10.0);
+
+    mBefore = responseTimeStamp;
+
+    return response;
+}
+
+std::vector<std::vector<uint8_t>>
+LocalReaderAdapter::exchangeApdus(
+    const std::shared_ptr<BatchTransmitReaderSpi> batchReader,
+    const std::vector<std::vector<uint8_t>>& commands)
+{
+    const uint64_t timeStamp = System::nanoTime();
+
+    KEYPLE_SERVICE_DEBUG(
+        mLogger,
+        "Reader [%] --> batch of % apduRequest(s), elapsed % ms\n",
+        getName(),
+        commands.size(),
+        (timeStamp - mBefore) / 100000 / 10.0);
+
+    std::vector<std::vector<uint8_t>> responses;
+    try {
+        responses = batchReader->transmitApdus(commands);
+        if (responses.empty() || responses.size() > commands.size()) {
+            throw ReaderIOException(
+                "Unexpected number of responses to a batch of "
+                + std::to_string(commands.size())
+                + " APDU commands: " + std::to_string(responses.size()));
+        }
+    } catch (const Exception& e) {
+        (void)e;
+        const uint64_t failureTimeStamp = System::nanoTime();
+        for (const auto& command : commands) {
+            mApduTrace.recordFailure(command, timeStamp, failureTimeStamp);
+        }
+        if (mApduTraceDumpOnFailureEnabled) {
+            dumpApduTrace();
+        }
+        throw;
+    }
+
+    const uint64_t responseTimeStamp = System::nanoTime();
+
+    for (std::size_t i = 0; i < responses.size(); i++) {
+        mApduTrace.record(
+            commands[i], responses[i], timeStamp, responseTimeStamp);
+    }
+
+    KEYPLE_SERVICE_DEBUG(
+        mLogger,
+        "Reader [%] <-- % apduResponse(s), elapsed % ms\n",
+        getName(),
+        responses.size(),
+        (responseTimeStamp - timeStamp) / 100000 / 10.0);
+
+    mBefore = responseTimeStamp;
+
+    return responses;
+}
+
+CardRequestResult
+LocalReaderAdapter::tryProcessCardRequest(
     const std::shared_ptr<CardRequestSpi> cardRequest)
 {
     std::vector<std::shared_ptr<ApduResponseApi>> apduResponses;
 
+    const std::vector<std::shared_ptr<ApduRequestSpi>>& apduRequests
+        = cardRequest->getApduRequests();
+
+    /* Readers able to transmit several APDUs in one exchange */
+    const auto batchReader
+        = std::dynamic_pointer_cast<BatchTransmitReaderSpi>(mReaderSpi);
+
     /* Proceeds with the APDU requests present in the CardRequest */
-    for (const auto& apduRequest : cardRequest->getApduRequests()) {
+    std::size_t index = 0;
+    bool isStatusWordUnexpected = false;
+    while (index < apduRequests.size() && !isStatusWordUnexpected) {
         try {
-            const auto apduResponse = processApduRequest(apduRequest);
-            apduResponses.push_back(apduResponse);
-
-            const std::vector<int>& successfulSW
-                = apduRequest->getSuccessfulStatusWords();
-            if (cardRequest->stopOnUnsuccessfulStatusWord()
-                && std::find(
-                       successfulSW.begin(),
-                       successfulSW.end(),
-                       apduResponse->getStatusWord())
-                       == apduRequest->getSuccessfulStatusWords().end()) {
-                throw UnexpectedStatusWordException(
-                    std::make_shared<CardResponseAdapter>(apduResponses, false),
-                    cardRequest->getApduRequests().size()
-                        == apduResponses.size(),
-                    "Unexpected status word");
+            if (batchReader && apduRequests.size() - index > 1) {
+                index += processApduRequestBatch(
+                    batchReader,
+                    cardRequest,
+                    index,
+                    apduResponses,
+                    isStatusWordUnexpected);
+            } else {
+                const auto& apduRequest = apduRequests[index];
+                isStatusWordUnexpected = addApduResponse(
+                    cardRequest,
+                    apduRequest,
+                    processApduRequest(apduRequest),
+                    apduResponses);
+                index++;
             }
         } catch (const ReaderIOException& e) {
             /*
              * The process has been interrupted. We close the logical channel
-             * and launch a KeypleReaderException with the Apdu responses
-             * collected so far.
+             * and report a reader failure with the Apdu responses collected
+             * so far.
              */
             closeLogicalAndPhysicalChannelsSilently();
 
-            throw ReaderBrokenCommunicationException(
-                std::make_shared<CardResponseAdapter>(apduResponses, false),
+            return CardRequestResult(
+                CardRequestResult::Status::READER_COMMUNICATION_FAILURE,
+                makeResponse<CardResponseAdapter>(apduResponses, false),
                 false,
                 "Reader communication failure while transmitting a card "
                 "request",
@@ -524,21 +703,157 @@ LocalReaderAdapter::processCardRequest(
         } catch (const CardIOException& e) {
             /*
              * The process has been interrupted. We close the logical channel
-             * and launch a KeypleReaderException with the Apdu responses
-             * collected so far.
+             * and report a card failure with the Apdu responses collected so
+             * far.
              */
             closeLogicalAndPhysicalChannelsSilently();
 
-            throw CardBrokenCommunicationException(
-                std::make_shared<CardResponseAdapter>(apduResponses, false),
+            return CardRequestResult(
+                CardRequestResult::Status::CARD_COMMUNICATION_FAILURE,
+                makeResponse<CardResponseAdapter>(apduResponses, false),
                 false,
                 "Card communication failure while transmitting a card request",
                 std::make_shared<CardIOException>(e));
         }
     }
 
-    return std::make_shared<CardResponseAdapter>(
-        apduResponses, mIsLogicalChannelOpen);
+    if (isStatusWordUnexpected) {
+        return CardRequestResult(
+            CardRequestResult::Status::UNEXPECTED_STATUS_WORD,
+            makeResponse<CardResponseAdapter>(apduResponses, false),
+            apduRequests.size() == apduResponses.size(),
+            "Unexpected status word",
+            nullptr);
+    }
+
+    return CardRequestResult(makeResponse<CardResponseAdapter>(
+        apduResponses, mIsLogicalChannelOpen));
+}
+
+std::size_t
+LocalReaderAdapter::processApduRequestBatch(
+    const std::shared_ptr<BatchTransmitReaderSpi> batchReader,
+    const std::shared_ptr<CardRequestSpi> cardRequest,
+    const std::size_t index,
+    std::vector<std::shared_ptr<ApduResponseApi>>& apduResponses,
+    bool& isStatusWordUnexpected)
+{
+    const std::vector<std::shared_ptr<ApduRequestSpi>>& apduRequests
+        = cardRequest->getApduRequests();
+
+    /*
+     * C++: the only copy of the commands, imposed by ApduRequestSpi. The
+     * batch ends with the first case 4 command.
+     */
+    std::vector<std::vector<uint8_t>> commands;
+    for (std::size_t i = index; i < apduRequests.size(); i++) {
+        commands.push_back(apduRequests[i]->getApdu());
+        if (ApduUtil::isCase4(commands.back())) {
+            break;
+        }
+    }
+
+    if (commands.size() == 1) {
+        const auto& apduRequest = apduRequests[index];
+        isStatusWordUnexpected = addApduResponse(
+            cardRequest,
+            apduRequest,
+            processApdu(
+                commands[0],
+                apduRequest->getSuccessfulStatusWords(),
+                apduRequest->getInfo()),
+            apduResponses);
+
+        return 1;
+    }
+
+    std::vector<std::vector<uint8_t>> responses
+        = exchangeApdus(batchReader, commands);
+
+    /* Only the last response may still have to be completed */
+    for (std::size_t i = 0; i < responses.size(); i++) {
+        const auto& apduRequest = apduRequests[index + i];
+        isStatusWordUnexpected = addApduResponse(
+            cardRequest,
+            apduRequest,
+            completeApduResponse(
+                commands[i],
+                std::move(responses[i]),
+                apduRequest->getSuccessfulStatusWords(),
+                apduRequest->getInfo()),
+            apduResponses);
+
+        if (isStatusWordUnexpected) {
+            return i + 1;
+        }
+    }
+
+    return responses.size();
+}
+
+bool
+LocalReaderAdapter::addApduResponse(
+    const std::shared_ptr<CardRequestSpi> cardRequest,
+    const std::shared_ptr<ApduRequestSpi> apduRequest,
+    const std::shared_ptr<ApduResponseAdapter> apduResponse,
+    std::vector<std::shared_ptr<ApduResponseApi>>& apduResponses)
+{
+    apduResponses.push_back(apduResponse);
+
+    const std::vector<int>& successfulSW
+        = apduRequest->getSuccessfulStatusWords();
+
+    return cardRequest->stopOnUnsuccessfulStatusWord()
+           && std::find(
+                  successfulSW.begin(),
+                  successfulSW.end(),
+                  apduResponse->getStatusWord())
+                  == successfulSW.end();
+}
+
+void
+LocalReaderAdapter::setTransactionArenaEnabled(const bool enabled)
+{
+    mTransactionArenaEnabled = enabled;
+}
+
+std::shared_ptr<TransactionArena>
+LocalReaderAdapter::getTransactionArena()
+{
+    const std::lock_guard<std::mutex> lock(mTransactionArenaMutex);
+
+    if (mTransactionArenaThread != std::this_thread::get_id()) {
+        return nullptr;
+    }
+
+    return mTransactionArena;
+}
+
+std::vector<ApduTraceBuffer::Record>
+LocalReaderAdapter::getApduTrace() const
+{
+    return mApduTrace.snapshot();
+}
+
+void
+LocalReaderAdapter::dumpApduTrace() const
+{
+    const std::vector<ApduTraceBuffer::Record> records = mApduTrace.snapshot();
+
+    mLogger->warn(
+        "Reader [%] APDU trace, last % exchange(s):\n",
+        getName(),
+        records.size());
+
+    for (const auto& record : records) {
+        mLogger->warn("Reader [%] %\n", getName(), record);
+    }
+}
+
+void
+LocalReaderAdapter::setApduTraceDumpOnFailureEnabled(const bool enabled)
+{
+    mApduTraceDumpOnFailureEnabled = enabled;
 }
 
 void
@@ -546,6 +861,8 @@ LocalReaderAdapter::releaseChannel()
 {
     checkStatus();
 
+    const std::lock_guard<std::recursive_mutex> lock(getTransmissionMutex());
+
     try {
         mReaderSpi->closePhysicalChannel();
     } catch (const ReaderIOException& e) {
@@ -624,20 +941,31 @@ std::shared_ptr<CardResponseApi>
 LocalReaderAdapter::processCardRequest(
     const std::shared_ptr<CardRequestSpi> cardRequest,
     const ChannelControl channelControl)
+{
+    return tryProcessCardRequest(cardRequest, channelControl)
+        .getCardResponseOrThrow();
+}
+
+CardRequestResult
+LocalReaderAdapter::tryProcessCardRequest(
+    const std::shared_ptr<CardRequestSpi> cardRequest,
+    const ChannelControl channelControl)
 {
     checkStatus();
 
-    std::shared_ptr<CardResponseAdapter> cardResponse = nullptr;
+    const TransactionArenaScope transactionArenaScope(this);
 
     /* Process the CardRequest and keep the CardResponse */
-    cardResponse = processCardRequest(cardRequest);
+    const CardRequestResult cardRequestResult
+        = tryProcessCardRequest(cardRequest);
 
-    /* Close the channel if requested */
-    if (channelControl == ChannelControl::CLOSE_AFTER) {
+    /* Close the channel if requested (as before, not after a failure) */
+    if (cardRequestResult.isSuccessful()
+        && channelControl == ChannelControl::CLOSE_AFTER) {
         releaseChannel();
     }
 
-    return cardResponse;
+    return cardRequestResult;
 }
 
 std::vector<std::shared_ptr<CardSelectionResponseApi>>
@@ -650,6 +978,8 @@ LocalReaderAdapter::processCardSelectionRequests(
 {
     checkStatus();
 
+    const TransactionArenaScope transactionArenaScope(this);
+
     /* Open the physical channel, determine the current protocol */
     if (!mReaderSpi->isPhysicalChannelOpen()) {
         try {
@@ -709,6 +1039,9 @@ LocalReaderAdapter::processCardSelectionRequests(
 void
 LocalReaderAdapter::doUnregister()
 {
+    /* No more asynchronous request on the channel about to be closed */
+    shutdownIoWorker();
+
     try {
         mReaderSpi->closePhysicalChannel();
     } catch (const Exception& e) {
@@ -775,85 +1108,48 @@ LocalReaderAdapter::SelectionStatus::SelectionStatus(
 {
 }
 
-/* APDU REQUEST
- * ---------------------------------------------------------------------------------
- */
-
-const int LocalReaderAdapter::ApduRequest::DEFAULT_SUCCESSFUL_CODE = 0x9000;
-
-LocalReaderAdapter::ApduRequest::ApduRequest(const std::vector<uint8_t>& apdu)
-: mApdu(apdu)
-, mSuccessfulStatusWords({DEFAULT_SUCCESSFUL_CODE})
-{
-}
-
-LocalReaderAdapter::ApduRequest&
-LocalReaderAdapter::ApduRequest::setInfo(const std::string& info)
-{
-    mInfo = info;
-
-    return *this;
-}
+/* TRANSACTION ARENA SCOPE
+ * ------------------------------------------------------------------------- */
 
-std::vector<uint8_t>
-LocalReaderAdapter::ApduRequest::getApdu() const
+LocalReaderAdapter::TransactionArenaScope::TransactionArenaScope(
+    LocalReaderAdapter* reader)
+: mReader(reader)
+, mOwner(false)
 {
-    return mApdu;
-}
+    if (!mReader->mTransactionArenaEnabled) {
+        return;
+    }
 
-const std::vector<int>&
-LocalReaderAdapter::ApduRequest::getSuccessfulStatusWords() const
-{
-    return mSuccessfulStatusWords;
-}
+    const std::lock_guard<std::mutex> lock(mReader->mTransactionArenaMutex);
 
-const std::string&
-LocalReaderAdapter::ApduRequest::getInfo() const
-{
-    return mInfo;
-}
-
-std::ostream&
-operator<<(std::ostream& os, LocalReaderAdapter::ApduRequest& ar)
-{
-    os << "APDU_REQUEST: {"
-       << "APDU: " << ar.getApdu() << ", "
-       << "SUCCESSFUL_STATUS_WORDS: " << ar.getSuccessfulStatusWords() << ", "
-       << "INFO: " << ar.getInfo() << "}";
+    if (mReader->mTransactionArena != nullptr) {
+        return;
+    }
 
-    return os;
-}
+    mOwner = true;
 
-std::ostream&
-operator<<(
-    std::ostream& os, const std::shared_ptr<LocalReaderAdapter::ApduRequest> ar)
-{
-    if (ar == nullptr) {
-        os << "APDU_REQUEST: null";
+    /* Reuse the previous arena once all its responses are released */
+    std::shared_ptr<TransactionArena> arena
+        = std::move(mReader->mLastTransactionArena);
+    if (arena != nullptr && arena.use_count() == 1) {
+        arena->reset();
     } else {
-        os << *ar;
+        arena = std::make_shared<TransactionArena>(
+            TRANSACTION_ARENA_BLOCK_SIZE);
     }
 
-    return os;
+    mReader->mTransactionArena = arena;
+    mReader->mTransactionArenaThread = std::this_thread::get_id();
 }
 
-std::ostream&
-operator<<(
-    std::ostream& os,
-    const std::vector<std::shared_ptr<LocalReaderAdapter::ApduRequest>>& ars)
+LocalReaderAdapter::TransactionArenaScope::~TransactionArenaScope()
 {
-    os << "APDU_REQUESTS: {";
-
-    for (auto it = ars.begin(); it != ars.end(); it++) {
-        if (it != ars.begin()) {
-            os << ", ";
-        }
-        os << *it;
+    if (mOwner) {
+        const std::lock_guard<std::mutex> lock(mReader->mTransactionArenaMutex);
+        mReader->mLastTransactionArena = std::move(mReader->mTransactionArena);
+        mReader->mTransactionArena = nullptr;
+        mReader->mTransactionArenaThread = std::thread::id();
     }
-
-    os << "}";
-
-    return os;
 }
 
 } /* namespace service */
@@ -15,6 +15,7 @@
 
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "keyple/core/plugin/PluginIOException.hpp"
@@ -46,10 +47,21 @@ ObservableLocalPluginAdapter::ObservableLocalPluginAdapter(
 
 ObservableLocalPluginAdapter::~ObservableLocalPluginAdapter()
 {
-    if (mThread) {
-        mThread->end();
-        while (mThread->mRunning || !mThread->mTerminated) {
-        }
+    stopMonitoringThread();
+}
+
+void
+ObservableLocalPluginAdapter::stopMonitoringThread()
+{
+    if (mThread == nullptr) {
+        return;
+    }
+
+    mThread->end();
+
+    /* The thread refers to this plugin, it must exit first */
+    if (mThread->mThreadId != std::this_thread::get_id()) {
+        mThread->mTerminated.await();
     }
 }
 
@@ -67,13 +79,16 @@ ObservableLocalPluginAdapter::addObserver(
 
     if (countObservers() == 1) {
         mLogger->info("Start monitoring the plugin [%]\n", getName());
+
+        /* A previous thread may still be completing its last cycle */
+        stopMonitoringThread();
+
         mThread = std::make_shared<EventThread>(getName(), this);
         mThread->setName("PluginEventMonitoringThread");
         mThread->setUncaughtExceptionHandler(
             std::make_shared<UncaughtExceptionHandler>(this));
         mThread->start();
-        while (!mThread->mStarted) {
-        }
+        mThread->mStarted.await();
     }
 }
 
@@ -137,8 +152,8 @@ ObservableLocalPluginAdapter::EventThread::EventThread(
 , mMonitoringCycleDuration(
       parent->mObservablePluginSpi->getMonitoringCycleDuration())
 , mRunning(true)
-, mStarted(false)
-, mTerminated(false)
+, mStarted(1)
+, mTerminated(1)
 , mParent(parent)
 {
 }
@@ -147,6 +162,7 @@ void
 ObservableLocalPluginAdapter::EventThread::end()
 {
     mRunning = false;
+    mCancellationToken.cancel();
     interrupt();
 }
 
@@ -262,7 +278,8 @@ ObservableLocalPluginAdapter::EventThread::processChanges(
 void
 ObservableLocalPluginAdapter::EventThread::execute()
 {
-    mStarted = true;
+    mThreadId = std::this_thread::get_id();
+    mStarted.countDown();
 
     try {
         while (mRunning) {
@@ -281,8 +298,9 @@ ObservableLocalPluginAdapter::EventThread::execute()
                 processChanges(actualNativeReaderNames);
             }
 
-            /* Sleep for a while */
-            Thread::sleep(mMonitoringCycleDuration);
+            /* Sleep for a while, unless the monitoring is ended meanwhile */
+            mCancellationToken.waitForCancellation(
+                static_cast<long>(mMonitoringCycleDuration));
         }
     } catch (const InterruptedException& e) {
         (void)e;
@@ -299,9 +317,13 @@ ObservableLocalPluginAdapter::EventThread::execute()
         mParent->getObservationManager()
             ->getObservationExceptionHandler()
             ->onPluginObservationError(mPluginName, kpe);
+    } catch (...) {
+        /* Left to the uncaught exception handler */
+        mTerminated.countDown();
+        throw;
     }
 
-    mTerminated = true;
+    mTerminated.countDown();
 }
 
 } /* namespace service */
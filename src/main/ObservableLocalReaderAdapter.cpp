@@ -13,6 +13,7 @@
 
 #include "keyple/core/service/ObservableLocalReaderAdapter.hpp"
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -22,8 +23,11 @@
 #include "keyple/core/service/ObservableReaderStateServiceAdapter.hpp"
 #include "keyple/core/service/ReaderEventAdapter.hpp"
 #include "keyple/core/service/ScheduledCardSelectionsResponseAdapter.hpp"
+#include "keyple/core/service/SmartCardServiceAdapter.hpp"
 #include "keyple/core/util/cpp/Arrays.hpp"
 #include "keyple/core/util/cpp/exception/Exception.hpp"
+#include "keyple/core/util/cpp/exception/IllegalArgumentException.hpp"
+#include "keyple/core/util/cpp/exception/IllegalStateException.hpp"
 #include "keypop/card/CardBrokenCommunicationException.hpp"
 #include "keypop/card/ReaderBrokenCommunicationException.hpp"
 #include "keypop/reader/ReaderCommunicationException.hpp"
@@ -34,8 +38,11 @@ namespace service {
 
 using keyple::core::plugin::CardIOException;
 using keyple::core::plugin::ReaderIOException;
+using keyple::core::service::cpp::ExecutorService;
 using keyple::core::util::cpp::Arrays;
 using keyple::core::util::cpp::exception::Exception;
+using keyple::core::util::cpp::exception::IllegalArgumentException;
+using keyple::core::util::cpp::exception::IllegalStateException;
 using keypop::card::CardBrokenCommunicationException;
 using keypop::card::ReaderBrokenCommunicationException;
 using keypop::reader::ReaderCommunicationException;
@@ -47,11 +54,13 @@ ObservableLocalReaderAdapter::ObservableLocalReaderAdapterJob::
     ObservableLocalReaderAdapterJob(
         std::shared_ptr<CardReaderObserverSpi> observer,
         const std::shared_ptr<CardReaderEvent> event,
-        ObservableLocalReaderAdapter* parent)
+        std::shared_ptr<ObservableLocalReaderAdapter> parent,
+        std::shared_ptr<TapDelivery> tapDelivery)
 : Job("ObservableLocalReaderAdapter")
 , mObserver(observer)
 , mEvent(event)
 , mParent(parent)
+, mTapDelivery(tapDelivery)
 {
 }
 
@@ -59,6 +68,7 @@ void
 ObservableLocalReaderAdapter::ObservableLocalReaderAdapterJob::execute()
 {
     mParent->notifyObserver(mObserver, mEvent);
+    mParent->onEventDelivered(mTapDelivery);
 }
 
 /* OBSERVABLE LOCAL READER ADAPTER
@@ -68,6 +78,7 @@ const std::vector<uint8_t> ObservableLocalReaderAdapter::APDU_PING_CARD_PRESENCE
     = {0x00, 0xC0, 0x00, 0x00, 0x00};
 const std::string ObservableLocalReaderAdapter::READER_MONITORING_ERROR
     = "An error occurred while monitoring the reader.";
+const long ObservableLocalReaderAdapter::MIN_POLL_DELAY_MILLIS = 1;
 
 ObservableLocalReaderAdapter::ObservableLocalReaderAdapter(
     std::shared_ptr<ObservableReaderSpi> observableReaderSpi,
@@ -79,7 +90,19 @@ ObservableLocalReaderAdapter::ObservableLocalReaderAdapter(
       std::make_shared<ObservationManagerAdapter<
           CardReaderObserverSpi,
           CardReaderObservationExceptionHandlerSpi>>(pluginName, getName()))
+, mCardProcessingTimeoutMillis(0)
+, mMissedProcessingDeadlineCount(0)
+, mCardPresenceProbeApdu(APDU_PING_CARD_PRESENCE)
+, mCardPresenceProbeCount(0)
+, mLastCardPresenceProbeLatencyMicros(0)
+, mMaxCardPresenceProbeLatencyMicros(0)
+, mCardDetectedAtMicros(0)
+, mTapAtMicros(0)
 {
+    mObservationManager->setEventNotificationThreadPool(
+        SmartCardServiceAdapter::getInstance()
+            ->getEventNotificationThreadPool());
+
     auto asynchronousInsertion
         = std::dynamic_pointer_cast<CardInsertionWaiterAsynchronousSpi>(
             observableReaderSpi);
@@ -129,30 +152,207 @@ ObservableLocalReaderAdapter::getCurrentMonitoringState() const
     return mStateService->getCurrentMonitoringState();
 }
 
+int
+ObservableLocalReaderAdapter::getEventQueueDepth() const
+{
+    return mStateService->getEventQueueDepth();
+}
+
+int
+ObservableLocalReaderAdapter::getMaxEventQueueDepth() const
+{
+    return mStateService->getMaxEventQueueDepth();
+}
+
+long
+ObservableLocalReaderAdapter::getCoalescedEventCount() const
+{
+    return mStateService->getCoalescedEventCount();
+}
+
+long
+ObservableLocalReaderAdapter::getTransitionCount(
+    const MonitoringState state, const InternalEvent event) const
+{
+    return mStateService->getTransitionCount(state, event);
+}
+
+long
+ObservableLocalReaderAdapter::getTimeInState(const MonitoringState state) const
+{
+    return mStateService->getTimeInState(state);
+}
+
+void
+ObservableLocalReaderAdapter::setCardProcessingTimeout(const long timeoutMillis)
+{
+    if (timeoutMillis < 0) {
+        throw IllegalArgumentException("timeoutMillis must be positive");
+    }
+
+    mCardProcessingTimeoutMillis = timeoutMillis;
+}
+
+long
+ObservableLocalReaderAdapter::getCardProcessingTimeout() const
+{
+    return mCardProcessingTimeoutMillis;
+}
+
+long
+ObservableLocalReaderAdapter::getMissedProcessingDeadlineCount() const
+{
+    return mMissedProcessingDeadlineCount;
+}
+
 bool
 ObservableLocalReaderAdapter::isCardPresentPing()
 {
+    const auto start = std::chrono::steady_clock::now();
+    const auto recordLatency = [this, &start] {
+        recordCardPresenceProbeLatency(static_cast<long>(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start)
+                .count()));
+    };
+    bool cardPresent = true;
+    std::shared_ptr<ReaderIOException> rioe = nullptr;
+
     /* Transmits the APDU and checks for the IO exception */
     try {
-        mObservableReaderSpi->transmitApdu(APDU_PING_CARD_PRESENCE);
+        if (!mCardPresenceProbeApdu.empty()) {
+            mObservableReaderSpi->transmitApdu(mCardPresenceProbeApdu);
+        } else {
+            cardPresent = mObservableReaderSpi->checkCardPresence();
+        }
     } catch (const ReaderIOException& e) {
+        rioe = std::make_shared<ReaderIOException>(e);
+
+    } catch (const CardIOException&) {
+        cardPresent = false;
+
+    } catch (...) {
+        recordLatency();
+        throw;
+    }
+
+    /* Recorded whatever the outcome, the handler duration excluded */
+    recordLatency();
+
+    if (rioe != nullptr) {
         /* Notify the reader communication failure with the exception handler */
-        const auto rioe = std::make_shared<ReaderIOException>(e);
         const auto rce = std::make_shared<ReaderCommunicationException>(
             READER_MONITORING_ERROR, rioe);
         getObservationExceptionHandler()->onReaderObservationError(
             getPluginName(), getName(), rce);
         return false;
+    }
 
-    } catch (const CardIOException&) {
-        return false;
+    return cardPresent;
+}
+
+void
+ObservableLocalReaderAdapter::setCardPresenceProbeApdu(
+    const std::vector<uint8_t>& apdu)
+{
+    if (getCurrentMonitoringState()
+        != MonitoringState::WAIT_FOR_START_DETECTION) {
+        throw IllegalStateException(
+            "The card presence probe cannot be changed while the card "
+            "detection is started");
     }
 
-    return true;
+    mCardPresenceProbeApdu = apdu;
+}
+
+long
+ObservableLocalReaderAdapter::getCardPresenceProbeCount() const
+{
+    return mCardPresenceProbeCount;
+}
+
+long
+ObservableLocalReaderAdapter::getLastCardPresenceProbeLatency() const
+{
+    return mLastCardPresenceProbeLatencyMicros;
+}
+
+long
+ObservableLocalReaderAdapter::getMaxCardPresenceProbeLatency() const
+{
+    return mMaxCardPresenceProbeLatencyMicros;
+}
+
+void
+ObservableLocalReaderAdapter::recordCardPresenceProbeLatency(
+    const long latencyMicros)
+{
+    mCardPresenceProbeCount++;
+    mLastCardPresenceProbeLatencyMicros = latencyMicros;
+
+    long maxLatencyMicros = mMaxCardPresenceProbeLatencyMicros;
+    while (latencyMicros > maxLatencyMicros
+           && !mMaxCardPresenceProbeLatencyMicros.compare_exchange_weak(
+               maxLatencyMicros, latencyMicros)) {
+    }
+}
+
+void
+ObservableLocalReaderAdapter::recordCardDetection()
+{
+    mCardDetectedAtMicros = steadyClockMicros();
+}
+
+const LatencyHistogram&
+ObservableLocalReaderAdapter::getLatencyHistogram(
+    const LatencyStage stage) const
+{
+    return mLatencyHistograms[static_cast<std::size_t>(stage)];
+}
+
+void
+ObservableLocalReaderAdapter::recordLatency(
+    const LatencyStage stage, const long long latencyMicros)
+{
+    mLatencyHistograms[static_cast<std::size_t>(stage)].record(latencyMicros);
+}
+
+long long
+ObservableLocalReaderAdapter::steadyClockMicros()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
 }
 
 std::shared_ptr<CardReaderEvent>
 ObservableLocalReaderAdapter::processCardInserted()
+{
+    const long long processingStartMicros = steadyClockMicros();
+
+    long long detectionMicros = mCardDetectedAtMicros.exchange(0);
+    if (detectionMicros == 0) {
+        detectionMicros = processingStartMicros;
+    }
+    recordLatency(
+        LatencyStage::CARD_DETECTION, processingStartMicros - detectionMicros);
+
+    const std::shared_ptr<CardReaderEvent> cardEvent
+        = processCardSelectionScenario();
+
+    /* The tap-to-event latency ends with the delivery of this event */
+    if (cardEvent != nullptr) {
+        const std::lock_guard<std::mutex> lock(mTapMutex);
+
+        mTapEvent = cardEvent;
+        mTapAtMicros = detectionMicros;
+    }
+
+    return cardEvent;
+}
+
+std::shared_ptr<CardReaderEvent>
+ObservableLocalReaderAdapter::processCardSelectionScenario()
 {
     /* RL-DET-INSNOTIF.1 */
     mLogger->trace("Process inserted card\n");
@@ -176,6 +376,8 @@ ObservableLocalReaderAdapter::processCardInserted()
      * notification mode and the selection status
      */
     try {
+        const long long selectionStartMicros = steadyClockMicros();
+
         const std::vector<std::shared_ptr<CardSelectionResponseApi>>
             cardSelectionResponses = transmitCardSelectionRequests(
                 mCardSelectionScenario->getCardSelectors(),
@@ -183,13 +385,24 @@ ObservableLocalReaderAdapter::processCardInserted()
                 mCardSelectionScenario->getMultiSelectionProcessing(),
                 mCardSelectionScenario->getChannelControl());
 
+        const long long selectionEndMicros = steadyClockMicros();
+        recordLatency(
+            LatencyStage::CARD_SELECTION,
+            selectionEndMicros - selectionStartMicros);
+
         if (hasACardMatched(cardSelectionResponses)) {
-            return std::make_shared<ReaderEventAdapter>(
-                getPluginName(),
-                getName(),
-                CardReaderEvent::Type::CARD_MATCHED,
-                std::make_shared<ScheduledCardSelectionsResponseAdapter>(
-                    cardSelectionResponses));
+            const std::shared_ptr<CardReaderEvent> cardEvent
+                = std::make_shared<ReaderEventAdapter>(
+                    getPluginName(),
+                    getName(),
+                    CardReaderEvent::Type::CARD_MATCHED,
+                    std::make_shared<ScheduledCardSelectionsResponseAdapter>(
+                        cardSelectionResponses));
+            recordLatency(
+                LatencyStage::EVENT_CREATION,
+                steadyClockMicros() - selectionEndMicros);
+
+            return cardEvent;
         }
 
         if (mNotificationMode == NotificationMode::MATCHED_ONLY) {
@@ -209,12 +422,18 @@ ObservableLocalReaderAdapter::processCardInserted()
             getName(),
             cardSelectionResponses.size());
 
-        return std::make_shared<ReaderEventAdapter>(
-            getPluginName(),
-            getName(),
-            CardReaderEvent::Type::CARD_INSERTED,
-            std::make_shared<ScheduledCardSelectionsResponseAdapter>(
-                cardSelectionResponses));
+        const std::shared_ptr<CardReaderEvent> cardEvent
+            = std::make_shared<ReaderEventAdapter>(
+                getPluginName(),
+                getName(),
+                CardReaderEvent::Type::CARD_INSERTED,
+                std::make_shared<ScheduledCardSelectionsResponseAdapter>(
+                    cardSelectionResponses));
+        recordLatency(
+            LatencyStage::EVENT_CREATION,
+            steadyClockMicros() - selectionEndMicros);
+
+        return cardEvent;
 
     } catch (const ReaderBrokenCommunicationException& e) {
         /* Notify the reader communication failure with the exception handler */
@@ -292,24 +511,127 @@ ObservableLocalReaderAdapter::processCardRemoved()
     }
 }
 
+void
+ObservableLocalReaderAdapter::setPollingPolicy(
+    std::shared_ptr<PollingPolicySpi> pollingPolicy)
+{
+    const std::lock_guard<std::mutex> lock(mPollingPolicyMutex);
+
+    mPollingPolicy = pollingPolicy;
+}
+
+long
+ObservableLocalReaderAdapter::getNextPollDelay(
+    const bool monitorInsertion,
+    const int pollCount,
+    const long defaultDelayMillis) const
+{
+    std::shared_ptr<PollingPolicySpi> pollingPolicy;
+
+    {
+        const std::lock_guard<std::mutex> lock(mPollingPolicyMutex);
+
+        pollingPolicy = mPollingPolicy;
+    }
+
+    const long delayMillis
+        = pollingPolicy != nullptr
+              ? pollingPolicy->getNextPollDelay(
+                  monitorInsertion, pollCount, defaultDelayMillis)
+              : defaultDelayMillis;
+
+    return delayMillis > MIN_POLL_DELAY_MILLIS ? delayMillis
+                                               : MIN_POLL_DELAY_MILLIS;
+}
+
+void
+ObservableLocalReaderAdapter::processCardProcessingTimeout()
+{
+    mMissedProcessingDeadlineCount++;
+
+    mLogger->warn(
+        "Reader [%] card processing not finalized within % ms, closing the "
+        "channels\n",
+        getName(),
+        mCardProcessingTimeoutMillis.load());
+
+    closeLogicalAndPhysicalChannelsSilently();
+}
+
 void
 ObservableLocalReaderAdapter::switchState(const MonitoringState stateId)
 {
     mStateService->switchState(stateId);
 }
 
+void
+ObservableLocalReaderAdapter::onEvent(const InternalEvent event)
+{
+    mStateService->onEvent(event);
+}
+
 void
 ObservableLocalReaderAdapter::notifyObservers(
     const std::shared_ptr<CardReaderEvent> event)
 {
+    const long long notificationStartMicros = steadyClockMicros();
+    const std::vector<std::shared_ptr<CardReaderObserverSpi>> observers
+        = mObservationManager->getObservers();
+
+    /* Only the event resulting from the last card tap is timed */
+    std::shared_ptr<TapDelivery> tapDelivery;
+    {
+        const std::lock_guard<std::mutex> lock(mTapMutex);
+
+        if (event == mTapEvent) {
+            mTapEvent = nullptr;
+            if (!observers.empty()) {
+                tapDelivery = std::make_shared<TapDelivery>(
+                    mTapAtMicros, static_cast<int>(observers.size()));
+            }
+        }
+    }
+
     mLogger->debug(
         "Reader [%] notifies event [%] to % observer(s)\n",
         getName(),
         event->getType(),
-        countObservers());
+        observers.size());
+
+    for (const auto& observer : observers) {
+        const std::shared_ptr<ExecutorService> executorService
+            = mObservationManager->getEventNotificationExecutor(observer);
+
+        if (executorService == nullptr) {
+            notifyObserver(observer, event);
+            onEventDelivered(tapDelivery);
+        } else {
+            /* Asynchronous notification, in order for each observer */
+            executorService->execute(
+                std::make_shared<ObservableLocalReaderAdapterJob>(
+                    observer,
+                    event,
+                    std::dynamic_pointer_cast<ObservableLocalReaderAdapter>(
+                        shared_from_this()),
+                    tapDelivery));
+        }
+    }
 
-    for (const auto& observer : mObservationManager->getObservers()) {
-        notifyObserver(observer, event);
+    if (tapDelivery != nullptr) {
+        recordLatency(
+            LatencyStage::EVENT_NOTIFICATION,
+            steadyClockMicros() - notificationStartMicros);
+    }
+}
+
+void
+ObservableLocalReaderAdapter::onEventDelivered(
+    const std::shared_ptr<TapDelivery>& tapDelivery)
+{
+    if (tapDelivery != nullptr && --tapDelivery->mPendingObserverCount == 0) {
+        recordLatency(
+            LatencyStage::TAP_TO_EVENT,
+            steadyClockMicros() - tapDelivery->mTapAtMicros);
     }
 }
 
@@ -416,6 +738,13 @@ ObservableLocalReaderAdapter::clearObservers()
     mObservationManager->clearObservers();
 }
 
+void
+ObservableLocalReaderAdapter::setEventNotificationThreadPool(
+    std::shared_ptr<MonitoringThreadPool> threadPool)
+{
+    mObservationManager->setEventNotificationThreadPool(threadPool);
+}
+
 void
 ObservableLocalReaderAdapter::startCardDetection(
     const DetectionMode detectionMode)
@@ -460,6 +789,7 @@ ObservableLocalReaderAdapter::setReaderObservationExceptionHandler(
 void
 ObservableLocalReaderAdapter::onCardInserted()
 {
+    recordCardDetection();
     mStateService->onEvent(InternalEvent::CARD_INSERTED);
 }
 
@@ -13,6 +13,8 @@
 
 #include "keyple/core/service/ObservableReaderStateServiceAdapter.hpp"
 
+#include <chrono>
+#include <future>
 #include <memory>
 
 #include "keyple/core/plugin/spi/reader/observable/state/insertion/CardInsertionWaiterAsynchronousSpi.hpp"
@@ -29,11 +31,14 @@
 #include "keyple/core/service/CardInsertionPassiveMonitoringJobAdapter.hpp"
 #include "keyple/core/service/CardRemovalActiveMonitoringJobAdapter.hpp"
 #include "keyple/core/service/CardRemovalPassiveMonitoringJobAdapter.hpp"
+#include "keyple/core/service/SmartCardServiceAdapter.hpp"
 #include "keyple/core/service/WaitForCardInsertionStateAdapter.hpp"
 #include "keyple/core/service/WaitForCardProcessingStateAdapter.hpp"
 #include "keyple/core/service/WaitForCardRemovalStateAdapter.hpp"
 #include "keyple/core/service/WaitForStartDetectStateAdapter.hpp"
 
+#include "cpp/HotPathLog.hpp"
+
 namespace keyple {
 namespace core {
 namespace service {
@@ -58,26 +63,51 @@ using keyple::core::plugin::spi::reader::observable::state::removal::
     CardRemovalWaiterNonBlockingSpi;
 using keyple::core::plugin::spi::reader::observable::state::removal::
     WaitForCardRemovalNonBlockingSpi;
+using keyple::core::service::cpp::JobFuture;
+using keyple::core::service::cpp::MonitoringThreadPool;
+using keyple::core::service::cpp::TimerWheel;
+
+const int
+    ObservableReaderStateServiceAdapter::DEFAULT_MONITORING_SLEEP_DURATION_MILLIS
+    = 100;
 
 ObservableReaderStateServiceAdapter::ObservableReaderStateServiceAdapter(
     ObservableLocalReaderAdapter* reader)
 : mReader(reader)
 , mReaderSpi(reader->getObservableReaderSpi())
-, mExecutorService(std::make_shared<ExecutorService>())
+, mCardProcessingTimeoutId(0)
+, mCurrentMonitoringState(MonitoringState::WAIT_FOR_START_DETECTION)
+, mTimeInStateMicros()
+, mStateEnteredAtMicros(steadyClockMicros())
+, mProcessingEvents(false)
+, mMaxEventQueueDepth(0)
+, mCoalescedEventCount(0)
 {
+    /* Monitoring jobs run on the shared pool when one is configured */
+    const std::shared_ptr<MonitoringThreadPool> threadPool
+        = SmartCardServiceAdapter::getInstance()->getMonitoringThreadPool();
+    mExecutorService = threadPool != nullptr
+                           ? std::make_shared<ExecutorService>(threadPool)
+                           : std::make_shared<ExecutorService>();
+
+    /*
+     * Active monitoring jobs and card processing timeouts are paced by the
+     * service-wide timer wheel
+     */
+    mTimerWheel
+        = SmartCardServiceAdapter::getInstance()->getMonitoringTimerWheel();
+
     /* Wait for start */
-    mStates.insert(
-        {MonitoringState::WAIT_FOR_START_DETECTION,
-         std::make_shared<WaitForStartDetectStateAdapter>(mReader)});
+    mStates[stateIndex(MonitoringState::WAIT_FOR_START_DETECTION)]
+        = std::make_shared<WaitForStartDetectStateAdapter>(mReader);
 
     /* Insertion */
     if (std::dynamic_pointer_cast<CardInsertionWaiterAsynchronousSpi>(
             mReaderSpi)
         || std::dynamic_pointer_cast<WaitForCardInsertionAutonomousSpi>(
             mReaderSpi)) {
-        mStates.insert(
-            {MonitoringState::WAIT_FOR_CARD_INSERTION,
-             std::make_shared<WaitForCardInsertionStateAdapter>(mReader)});
+        mStates[stateIndex(MonitoringState::WAIT_FOR_CARD_INSERTION)]
+            = std::make_shared<WaitForCardInsertionStateAdapter>(mReader);
 
     } else if (
         std::dynamic_pointer_cast<CardInsertionWaiterNonBlockingSpi>(mReaderSpi)
@@ -88,18 +118,21 @@ ObservableReaderStateServiceAdapter::ObservableReaderStateServiceAdapter(
                 mReaderSpi);
         int sleepDurationMillis
             = readerSpi ? readerSpi->getCardInsertionMonitoringSleepDuration()
-                        : 100;
+                        : DEFAULT_MONITORING_SLEEP_DURATION_MILLIS;
 
         auto cardInsertionActiveMonitoringJobAdapter
             = std::make_shared<CardInsertionActiveMonitoringJobAdapter>(
-                mReader, sleepDurationMillis, true);
-
-        mStates.insert(
-            {MonitoringState::WAIT_FOR_CARD_INSERTION,
-             std::make_shared<WaitForCardInsertionStateAdapter>(
-                 mReader,
-                 cardInsertionActiveMonitoringJobAdapter,
-                 mExecutorService)});
+                mReader,
+                sleepDurationMillis,
+                true,
+                mExecutorService,
+                mTimerWheel);
+
+        mStates[stateIndex(MonitoringState::WAIT_FOR_CARD_INSERTION)]
+            = std::make_shared<WaitForCardInsertionStateAdapter>(
+                mReader,
+                cardInsertionActiveMonitoringJobAdapter,
+                mExecutorService);
 
     } else if (
         std::dynamic_pointer_cast<CardInsertionWaiterBlockingSpi>(mReaderSpi)
@@ -108,12 +141,11 @@ ObservableReaderStateServiceAdapter::ObservableReaderStateServiceAdapter(
         auto cardInsertionPassiveMonitoringJobAdapter
             = std::make_shared<CardInsertionPassiveMonitoringJobAdapter>(
                 mReader);
-        mStates.insert(
-            {MonitoringState::WAIT_FOR_CARD_INSERTION,
-             std::make_shared<WaitForCardInsertionStateAdapter>(
-                 mReader,
-                 cardInsertionPassiveMonitoringJobAdapter,
-                 mExecutorService)});
+        mStates[stateIndex(MonitoringState::WAIT_FOR_CARD_INSERTION)]
+            = std::make_shared<WaitForCardInsertionStateAdapter>(
+                mReader,
+                cardInsertionPassiveMonitoringJobAdapter,
+                mExecutorService);
 
     } else {
         throw IllegalStateException(
@@ -127,26 +159,23 @@ ObservableReaderStateServiceAdapter::ObservableReaderStateServiceAdapter(
             WaitForCardRemovalDuringProcessingBlockingSpi>(mReaderSpi)) {
         auto cardRemovalPassiveMonitoringJobAdapter
             = std::make_shared<CardRemovalPassiveMonitoringJobAdapter>(mReader);
-        mStates.insert(
-            {MonitoringState::WAIT_FOR_CARD_PROCESSING,
-             std::make_shared<WaitForCardProcessingStateAdapter>(
-                 mReader,
-                 cardRemovalPassiveMonitoringJobAdapter,
-                 mExecutorService)});
+        mStates[stateIndex(MonitoringState::WAIT_FOR_CARD_PROCESSING)]
+            = std::make_shared<WaitForCardProcessingStateAdapter>(
+                mReader,
+                cardRemovalPassiveMonitoringJobAdapter,
+                mExecutorService);
 
     } else {
-        mStates.insert(
-            {MonitoringState::WAIT_FOR_CARD_PROCESSING,
-             std::make_shared<WaitForCardProcessingStateAdapter>(mReader)});
+        mStates[stateIndex(MonitoringState::WAIT_FOR_CARD_PROCESSING)]
+            = std::make_shared<WaitForCardProcessingStateAdapter>(mReader);
     }
 
     /* Removal */
     if (std::dynamic_pointer_cast<CardRemovalWaiterAsynchronousSpi>(mReaderSpi)
         || std::dynamic_pointer_cast<WaitForCardRemovalAutonomousSpi>(
             mReaderSpi)) {
-        mStates.insert(
-            {MonitoringState::WAIT_FOR_CARD_REMOVAL,
-             std::make_shared<WaitForCardRemovalStateAdapter>(mReader)});
+        mStates[stateIndex(MonitoringState::WAIT_FOR_CARD_REMOVAL)]
+            = std::make_shared<WaitForCardRemovalStateAdapter>(mReader);
 
     } else if (
         std::dynamic_pointer_cast<CardRemovalWaiterNonBlockingSpi>(mReaderSpi)
@@ -157,18 +186,17 @@ ObservableReaderStateServiceAdapter::ObservableReaderStateServiceAdapter(
                 mReaderSpi);
         int sleepDurationMillis
             = readerSpi ? readerSpi->getCardRemovalMonitoringSleepDuration()
-                        : 100;
+                        : DEFAULT_MONITORING_SLEEP_DURATION_MILLIS;
 
         auto cardRemovalActiveMonitoringJobAdapter
             = std::make_shared<CardRemovalActiveMonitoringJobAdapter>(
-                mReader, sleepDurationMillis);
+                mReader, sleepDurationMillis, mExecutorService, mTimerWheel);
 
-        mStates.insert(
-            {MonitoringState::WAIT_FOR_CARD_REMOVAL,
-             std::make_shared<WaitForCardRemovalStateAdapter>(
-                 mReader,
-                 cardRemovalActiveMonitoringJobAdapter,
-                 mExecutorService)});
+        mStates[stateIndex(MonitoringState::WAIT_FOR_CARD_REMOVAL)]
+            = std::make_shared<WaitForCardRemovalStateAdapter>(
+                mReader,
+                cardRemovalActiveMonitoringJobAdapter,
+                mExecutorService);
 
     } else if (
         std::dynamic_pointer_cast<CardRemovalWaiterBlockingSpi>(mReaderSpi)
@@ -176,12 +204,11 @@ ObservableReaderStateServiceAdapter::ObservableReaderStateServiceAdapter(
             mReaderSpi)) {
         auto cardRemovalPassiveMonitoringJobAdapter
             = std::make_shared<CardRemovalPassiveMonitoringJobAdapter>(mReader);
-        mStates.insert(
-            {MonitoringState::WAIT_FOR_CARD_REMOVAL,
-             std::make_shared<WaitForCardRemovalStateAdapter>(
-                 mReader,
-                 cardRemovalPassiveMonitoringJobAdapter,
-                 mExecutorService)});
+        mStates[stateIndex(MonitoringState::WAIT_FOR_CARD_REMOVAL)]
+            = std::make_shared<WaitForCardRemovalStateAdapter>(
+                mReader,
+                cardRemovalPassiveMonitoringJobAdapter,
+                mExecutorService);
 
     } else {
         throw IllegalStateException(
@@ -194,6 +221,87 @@ ObservableReaderStateServiceAdapter::ObservableReaderStateServiceAdapter(
 
 void
 ObservableReaderStateServiceAdapter::onEvent(const InternalEvent event)
+{
+    std::unique_lock<std::mutex> lock(mEventQueueMutex);
+
+    /* Drop an insertion the card did not survive */
+    if (event == InternalEvent::CARD_REMOVED && !mEventQueue.empty()
+        && mEventQueue.back() == InternalEvent::CARD_INSERTED) {
+        mEventQueue.pop_back();
+        mCoalescedEventCount++;
+        KEYPLE_SERVICE_TRACE(
+            mLogger,
+            "Reader [%] drops pending event CARD_INSERTED\n",
+            mReader->getName());
+    }
+
+    mEventQueue.push_back(event);
+
+    if (static_cast<int>(mEventQueue.size()) > mMaxEventQueueDepth) {
+        mMaxEventQueueDepth = static_cast<int>(mEventQueue.size());
+    }
+
+    /* Already being processed by another call */
+    if (mProcessingEvents) {
+        return;
+    }
+
+    mProcessingEvents = true;
+
+    while (!mEventQueue.empty()) {
+        const InternalEvent nextEvent = mEventQueue.front();
+        mEventQueue.pop_front();
+
+        lock.unlock();
+
+        /* A failing event must not leave the next ones queued */
+        try {
+            processEvent(nextEvent);
+        } catch (const Exception& e) {
+            notifyEventProcessingError(nextEvent, e);
+        } catch (...) {
+            /* The next call processes the remaining events */
+            lock.lock();
+            mProcessingEvents = false;
+            throw;
+        }
+
+        lock.lock();
+    }
+
+    mProcessingEvents = false;
+}
+
+void
+ObservableReaderStateServiceAdapter::notifyEventProcessingError(
+    const InternalEvent event, const Exception& e)
+{
+    const std::shared_ptr<CardReaderObservationExceptionHandlerSpi>
+        exceptionHandler = mReader->getObservationExceptionHandler();
+
+    if (exceptionHandler == nullptr) {
+        mLogger->error(
+            "Error processing event [%] on reader [%] - %\n",
+            event,
+            mReader->getName(),
+            e);
+        return;
+    }
+
+    try {
+        exceptionHandler->onReaderObservationError(
+            mReader->getPluginName(),
+            mReader->getName(),
+            std::make_shared<Exception>(e));
+    } catch (const Exception& e2) {
+        mLogger->error(
+            "Event processing error: % - %\n", e2.getMessage(), e2);
+        mLogger->error("Original cause: % - %\n", e.getMessage(), e);
+    }
+}
+
+void
+ObservableReaderStateServiceAdapter::processEvent(const InternalEvent event)
 {
     /*
      * C++: cannot use std::lock_guard as mutex needs to be unlocked before
@@ -220,55 +328,228 @@ ObservableReaderStateServiceAdapter::onEvent(const InternalEvent event)
 void
 ObservableReaderStateServiceAdapter::switchState(const MonitoringState stateId)
 {
-    std::lock_guard<std::mutex> lock(mMutex);
-
-    if (mCurrentState != nullptr) {
-        mLogger->trace(
-            "Switch state of reader [%] from % to %\n",
-            mReader->getName(),
-            mCurrentState->getMonitoringState(),
-            stateId);
-        mCurrentState->onDeactivate();
-    } else {
-        mLogger->trace(
-            "Switch state of reader [%] to %\n", mReader->getName(), stateId);
+    std::shared_ptr<JobFuture> stoppedJob;
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        const long long nowMicros = steadyClockMicros();
+
+        if (mCurrentState != nullptr) {
+            KEYPLE_SERVICE_TRACE(
+                mLogger,
+                "Switch state of reader [%] from % to %\n",
+                mReader->getName(),
+                mCurrentState->getMonitoringState(),
+                stateId);
+            stoppedJob = mCurrentState->onDeactivate();
+        } else {
+            KEYPLE_SERVICE_TRACE(
+                mLogger,
+                "Switch state of reader [%] to %\n",
+                mReader->getName(),
+                stateId);
+        }
+
+        /* The deadline only applies to the processing of the current card */
+        if (mCardProcessingTimeout != nullptr) {
+            mCardProcessingTimeout->cancel();
+            mCardProcessingTimeout = nullptr;
+        }
+        const long cardProcessingTimeoutId = ++mCardProcessingTimeoutId;
+
+        /* Switch currentState */
+        mCurrentState = mStates[stateIndex(stateId)];
+        {
+            const std::lock_guard<std::mutex> timeLock(mStateTimeMutex);
+
+            mTimeInStateMicros[stateIndex(mCurrentMonitoringState)]
+                += nowMicros - mStateEnteredAtMicros;
+            mStateEnteredAtMicros = nowMicros;
+            mCurrentMonitoringState = stateId;
+        }
+
+        /*
+         * As soon as the state machine returns to the WAIT_FOR_START_DETECTION
+         * state, we deactivate card detection in the plugin.
+         */
+        if (stateId == MonitoringState::WAIT_FOR_START_DETECTION) {
+            mReaderSpi->onStopDetection();
+        }
+
+        /* onActivate the new current state */
+        mCurrentState->onActivate();
+
+        const long timeoutMillis = mReader->getCardProcessingTimeout();
+        if (stateId == MonitoringState::WAIT_FOR_CARD_PROCESSING
+            && timeoutMillis > 0) {
+            const std::weak_ptr<ObservableReaderStateServiceAdapter> self
+                = shared_from_this();
+
+            /*
+             * The event is processed out of the executor of the monitoring
+             * jobs, which may be blocked by a passive card removal job until
+             * the resulting state switch stops it
+             */
+            if (mCardProcessingTimeoutExecutorService == nullptr) {
+                const std::shared_ptr<MonitoringThreadPool> threadPool
+                    = SmartCardServiceAdapter::getInstance()
+                          ->getMonitoringThreadPool();
+                mCardProcessingTimeoutExecutorService
+                    = threadPool != nullptr
+                          ? std::make_shared<ExecutorService>(threadPool)
+                          : std::make_shared<ExecutorService>();
+            }
+            const std::shared_ptr<ExecutorService> executorService
+                = mCardProcessingTimeoutExecutorService;
+
+            mCardProcessingTimeout = mTimerWheel->schedule(
+                [self, executorService, cardProcessingTimeoutId] {
+                    executorService->execute([self, cardProcessingTimeoutId] {
+                        const auto stateService = self.lock();
+                        if (stateService != nullptr
+                            && stateService->mCardProcessingTimeoutId
+                                   == cardProcessingTimeoutId) {
+                            stateService->onEvent(InternalEvent::TIME_OUT);
+                        }
+                    });
+                },
+                timeoutMillis);
+        }
     }
 
-    /* Switch currentState */
-    mCurrentState = mStates.at(stateId);
-
     /*
-     * As soon as the state machine returns to the WAIT_FOR_START_DETECTION
-     * state, we deactivate card detection in the plugin.
+     * C++: wait for the previous monitoring job to exit, out of the lock as
+     * it may need it to notify its last event (returns immediately when
+     * called by the job itself).
      */
-    if (stateId == MonitoringState::WAIT_FOR_START_DETECTION) {
-        mReaderSpi->onStopDetection();
+    if (stoppedJob != nullptr) {
+        const long timeoutMillis = SmartCardServiceAdapter::getInstance()
+                                       ->getMonitoringStopTimeout();
+
+        if (stoppedJob->wait_for(std::chrono::milliseconds(timeoutMillis))
+            != std::future_status::ready) {
+            mLogger->warn(
+                "Monitoring job of reader [%] still running after % ms\n",
+                mReader->getName(),
+                timeoutMillis);
+        }
     }
-
-    /* onActivate the new current state */
-    mCurrentState->onActivate();
 }
 
 std::shared_ptr<AbstractObservableStateAdapter>
 ObservableReaderStateServiceAdapter::getCurrentState()
 {
-    std::lock_guard<std::mutex> lock(mMutex);
-
-    return mCurrentState;
+    return mStates[stateIndex(mCurrentMonitoringState)];
 }
 
 MonitoringState
 ObservableReaderStateServiceAdapter::getCurrentMonitoringState()
 {
-    std::lock_guard<std::mutex> lock(mMutex);
+    return mCurrentMonitoringState;
+}
+
+std::size_t
+ObservableReaderStateServiceAdapter::stateIndex(const MonitoringState state)
+{
+    static_assert(
+        static_cast<std::size_t>(MonitoringState::WAIT_FOR_START_DETECTION)
+            == 0,
+        "the monitoring states must be indexed from 0");
+    static_assert(
+        MONITORING_STATE_COUNT == 4,
+        "the constructor must build a state for each monitoring state");
+
+    return static_cast<std::size_t>(state);
+}
+
+long long
+ObservableReaderStateServiceAdapter::steadyClockMicros()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+int
+ObservableReaderStateServiceAdapter::getEventQueueDepth()
+{
+    std::lock_guard<std::mutex> lock(mEventQueueMutex);
+
+    return static_cast<int>(mEventQueue.size());
+}
+
+int
+ObservableReaderStateServiceAdapter::getMaxEventQueueDepth()
+{
+    std::lock_guard<std::mutex> lock(mEventQueueMutex);
+
+    return mMaxEventQueueDepth;
+}
+
+long
+ObservableReaderStateServiceAdapter::getCoalescedEventCount()
+{
+    std::lock_guard<std::mutex> lock(mEventQueueMutex);
 
-    return mCurrentState->getMonitoringState();
+    return mCoalescedEventCount;
+}
+
+long
+ObservableReaderStateServiceAdapter::getTransitionCount(
+    const MonitoringState state, const InternalEvent event) const
+{
+    return mStates[stateIndex(state)]->getEventCount(event);
+}
+
+long
+ObservableReaderStateServiceAdapter::getTimeInState(
+    const MonitoringState state) const
+{
+    const std::lock_guard<std::mutex> lock(mStateTimeMutex);
+
+    long long timeMicros = mTimeInStateMicros[stateIndex(state)];
+
+    if (mCurrentMonitoringState == state) {
+        timeMicros += steadyClockMicros() - mStateEnteredAtMicros;
+    }
+
+    return static_cast<long>(timeMicros / 1000);
 }
 
 void
 ObservableReaderStateServiceAdapter::shutdown()
 {
-    mExecutorService->shutdown();
+    std::shared_ptr<ExecutorService> cardProcessingTimeoutExecutorService;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if (mCardProcessingTimeout != nullptr) {
+            mCardProcessingTimeout->cancel();
+            mCardProcessingTimeout = nullptr;
+        }
+        cardProcessingTimeoutExecutorService
+            = mCardProcessingTimeoutExecutorService;
+    }
+
+    const long timeoutMillis
+        = SmartCardServiceAdapter::getInstance()->getMonitoringStopTimeout();
+
+    if (!mExecutorService->shutdown(timeoutMillis)) {
+        mLogger->warn(
+            "Monitoring job of reader [%] still running after % ms\n",
+            mReader->getName(),
+            timeoutMillis);
+    }
+
+    if (cardProcessingTimeoutExecutorService != nullptr
+        && !cardProcessingTimeoutExecutorService->shutdown(timeoutMillis)) {
+        mLogger->warn(
+            "Card processing timeout of reader [%] still processed after % "
+            "ms\n",
+            mReader->getName(),
+            timeoutMillis);
+    }
 }
 
 } /* namespace service */
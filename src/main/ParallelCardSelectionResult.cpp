@@ -0,0 +1,58 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#include "keyple/core/service/ParallelCardSelectionResult.hpp"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+ParallelCardSelectionResult::ParallelCardSelectionResult(
+    const std::shared_ptr<CardReader> reader,
+    const std::shared_ptr<CardSelectionResult> cardSelectionResult,
+    const std::exception_ptr exception,
+    const long long elapsedMicros)
+: mReader(reader)
+, mCardSelectionResult(cardSelectionResult)
+, mException(exception)
+, mElapsedMicros(elapsedMicros)
+{
+}
+
+std::shared_ptr<CardReader>
+ParallelCardSelectionResult::getReader() const
+{
+    return mReader;
+}
+
+std::shared_ptr<CardSelectionResult>
+ParallelCardSelectionResult::getCardSelectionResult() const
+{
+    return mCardSelectionResult;
+}
+
+std::exception_ptr
+ParallelCardSelectionResult::getException() const
+{
+    return mException;
+}
+
+long long
+ParallelCardSelectionResult::getElapsedMicros() const
+{
+    return mElapsedMicros;
+}
+
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
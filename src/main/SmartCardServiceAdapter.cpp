@@ -13,6 +13,7 @@
 
 #include "keyple/core/service/SmartCardServiceAdapter.hpp"
 
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -28,6 +29,7 @@
 #include "keyple/core/service/AutonomousObservableLocalPluginAdapter.hpp"
 #include "keyple/core/service/KeyplePluginException.hpp"
 #include "keyple/core/service/LocalPoolPluginAdapter.hpp"
+#include "keyple/core/service/ObservableLocalReaderAdapter.hpp"
 #include "keyple/core/service/ObservableLocalPluginAdapter.hpp"
 #include "keyple/core/service/ReaderApiFactoryAdapter.hpp"
 #include "keyple/core/util/KeypleAssert.hpp"
@@ -67,6 +69,11 @@ const std::string SmartCardServiceAdapter::MSG_VERSION_MISMATCH_DETECTED
       "Compatibility issues "
       "may arise\n";
 
+const long SmartCardServiceAdapter::MONITORING_TIMER_TICK_MILLIS = 1;
+const int SmartCardServiceAdapter::MONITORING_TIMER_WHEEL_SIZE = 1024;
+const long SmartCardServiceAdapter::DEFAULT_MONITORING_STOP_TIMEOUT_MILLIS
+    = 1000;
+
 std::shared_ptr<SmartCardServiceAdapter> SmartCardServiceAdapter::mInstance;
 
 std::shared_ptr<SmartCardServiceAdapter>
@@ -322,6 +329,158 @@ SmartCardServiceAdapter::getReaderApiFactory()
         new ReaderApiFactoryAdapter());
 }
 
+void
+SmartCardServiceAdapter::setMonitoringThreadPool(
+    const int coreThreadCount,
+    const long keepAliveMillis,
+    const int maxThreadCount)
+{
+    const std::lock_guard<std::mutex> lock(mMonitoringThreadPoolMutex);
+
+    if (mMonitoringThreadPool != nullptr) {
+        throw IllegalStateException(
+            "The monitoring thread pool is already configured");
+    }
+
+    mLogger->info(
+        "Enabling a monitoring thread pool of % core threads (% max)\n",
+        coreThreadCount,
+        maxThreadCount);
+
+    mMonitoringThreadPool = std::make_shared<MonitoringThreadPool>(
+        coreThreadCount, keepAliveMillis, maxThreadCount);
+}
+
+std::shared_ptr<MonitoringThreadPool>
+SmartCardServiceAdapter::getMonitoringThreadPool() const
+{
+    const std::lock_guard<std::mutex> lock(mMonitoringThreadPoolMutex);
+
+    return mMonitoringThreadPool;
+}
+
+void
+SmartCardServiceAdapter::setEventNotificationThreadPool(
+    const int coreThreadCount,
+    const long keepAliveMillis,
+    const int maxThreadCount)
+{
+    const std::lock_guard<std::mutex> lock(mMonitoringThreadPoolMutex);
+
+    if (mEventNotificationThreadPool != nullptr) {
+        throw IllegalStateException(
+            "The event notification thread pool is already configured");
+    }
+
+    mLogger->info(
+        "Enabling an event notification thread pool of % core threads "
+        "(% max)\n",
+        coreThreadCount,
+        maxThreadCount);
+
+    mEventNotificationThreadPool = std::make_shared<MonitoringThreadPool>(
+        coreThreadCount, keepAliveMillis, maxThreadCount);
+}
+
+std::shared_ptr<MonitoringThreadPool>
+SmartCardServiceAdapter::getEventNotificationThreadPool() const
+{
+    const std::lock_guard<std::mutex> lock(mMonitoringThreadPoolMutex);
+
+    return mEventNotificationThreadPool;
+}
+
+void
+SmartCardServiceAdapter::setCardIoThreadPool(
+    const int coreThreadCount,
+    const long keepAliveMillis,
+    const int maxThreadCount)
+{
+    const std::lock_guard<std::mutex> lock(mMonitoringThreadPoolMutex);
+
+    if (mCardIoThreadPool != nullptr) {
+        throw IllegalStateException(
+            "The card I/O thread pool is already configured");
+    }
+
+    mLogger->info(
+        "Enabling a card I/O thread pool of % core threads (% max)\n",
+        coreThreadCount,
+        maxThreadCount);
+
+    mCardIoThreadPool = std::make_shared<MonitoringThreadPool>(
+        coreThreadCount, keepAliveMillis, maxThreadCount);
+}
+
+std::shared_ptr<MonitoringThreadPool>
+SmartCardServiceAdapter::getCardIoThreadPool() const
+{
+    const std::lock_guard<std::mutex> lock(mMonitoringThreadPoolMutex);
+
+    return mCardIoThreadPool;
+}
+
+std::shared_ptr<TimerWheel>
+SmartCardServiceAdapter::getMonitoringTimerWheel()
+{
+    const std::lock_guard<std::mutex> lock(mMonitoringThreadPoolMutex);
+
+    if (mMonitoringTimerWheel == nullptr) {
+        mMonitoringTimerWheel = std::make_shared<TimerWheel>(
+            MONITORING_TIMER_TICK_MILLIS, MONITORING_TIMER_WHEEL_SIZE);
+    }
+
+    return mMonitoringTimerWheel;
+}
+
+void
+SmartCardServiceAdapter::setMonitoringStopTimeout(const long timeoutMillis)
+{
+    if (timeoutMillis < 0) {
+        throw IllegalArgumentException("timeoutMillis must be positive");
+    }
+
+    mMonitoringStopTimeoutMillis = timeoutMillis;
+}
+
+long
+SmartCardServiceAdapter::getMonitoringStopTimeout() const
+{
+    return mMonitoringStopTimeoutMillis;
+}
+
+std::map<std::string, MonitoringState>
+SmartCardServiceAdapter::getMonitoringStateSnapshot() const
+{
+    std::vector<std::shared_ptr<Plugin>> plugins;
+    {
+        const std::lock_guard<std::mutex> lock(mMutex);
+
+        for (const auto& plugin : mPlugins) {
+            plugins.push_back(plugin.second);
+        }
+    }
+
+    /* The reader states are read out of the lock */
+    std::map<std::string, MonitoringState> states;
+
+    for (const auto& plugin : plugins) {
+        for (const auto& reader : plugin->getReaders()) {
+            const auto observableReader
+                = std::dynamic_pointer_cast<ObservableLocalReaderAdapter>(
+                    reader);
+
+            if (observableReader != nullptr) {
+                states.insert(
+                    {observableReader->getName(),
+                     observableReader->getCurrentMonitoringState()});
+            }
+        }
+    }
+
+    return states;
+}
+
 void
 SmartCardServiceAdapter::checkPoolPluginVersion(
     const std::shared_ptr<PoolPluginFactorySpi> poolPluginFactorySpi)
@@ -37,57 +37,6 @@ WaitForCardInsertionStateAdapter::WaitForCardInsertionStateAdapter(
 {
 }
 
-void
-WaitForCardInsertionStateAdapter::onEvent(const InternalEvent event)
-{
-    mLogger->trace(
-        "Internal event [%] received for reader [%] in current state [%]\n",
-        getReader()->getName(),
-        event,
-        getMonitoringState());
-
-    /* Process InternalEvent */
-    switch (event) {
-    case InternalEvent::CARD_INSERTED: {
-        /* Process default selection if any, return an event, can be null */
-        const std::shared_ptr<CardReaderEvent> cardEvent
-            = getReader()->processCardInserted();
-        if (cardEvent != nullptr) {
-            /* Switch internal state */
-            switchState(MonitoringState::WAIT_FOR_CARD_PROCESSING);
-            /* Notify the external observer of the event */
-            getReader()->notifyObservers(cardEvent);
-        } else {
-            /*
-             * If none event was sent to the application, back to card detection
-             * stay in the same state, however switch to WAIT_FOR_CARD_INSERTION
-             * to relaunch the monitoring job
-             */
-            mLogger->trace("Inserted card hasn't matched\n");
-
-            switchState(MonitoringState::WAIT_FOR_CARD_REMOVAL);
-        }
-        break;
-    }
-    case InternalEvent::STOP_DETECT:
-        switchState(MonitoringState::WAIT_FOR_START_DETECTION);
-        break;
-
-    case InternalEvent::CARD_REMOVED:
-        /* The card has been removed during default selection */
-        if (getReader()->getDetectionMode() == DetectionMode::REPEATING) {
-            switchState(MonitoringState::WAIT_FOR_CARD_INSERTION);
-        } else {
-            switchState(MonitoringState::WAIT_FOR_START_DETECTION);
-        }
-        break;
-
-    default:
-        mLogger->trace("Event ignored\n");
-        break;
-    }
-}
-
 } /* namespace service */
 } /* namespace core */
 } /* namespace keyple */
@@ -19,8 +19,6 @@ namespace keyple {
 namespace core {
 namespace service {
 
-using DetectionMode = ObservableCardReader::DetectionMode;
-
 WaitForCardProcessingStateAdapter::WaitForCardProcessingStateAdapter(
     ObservableLocalReaderAdapter* reader,
     std::shared_ptr<AbstractMonitoringJobAdapter> monitoringJob,
@@ -39,53 +37,6 @@ WaitForCardProcessingStateAdapter::WaitForCardProcessingStateAdapter(
 {
 }
 
-void
-WaitForCardProcessingStateAdapter::onEvent(const InternalEvent event)
-{
-    mLogger->trace(
-        "Internal event [%] received for reader [%] in current state [%]\n",
-        getReader()->getName(),
-        event,
-        getMonitoringState());
-
-    /* Process InternalEvent */
-    switch (event) {
-    case InternalEvent::CARD_PROCESSED:
-        if (getReader()->getDetectionMode() == DetectionMode::REPEATING) {
-            switchState(MonitoringState::WAIT_FOR_CARD_REMOVAL);
-        } else {
-            /* We close the channels now and notify the application of the
-             * CARD_REMOVED event */
-            getReader()->processCardRemoved();
-            switchState(MonitoringState::WAIT_FOR_START_DETECTION);
-        }
-        break;
-
-    case InternalEvent::CARD_REMOVED:
-        /*
-         * The card has been removed, we close all channels and return to the
-         * currentState of waiting for insertion We notify the application of
-         * the CARD_REMOVED event.
-         */
-        getReader()->processCardRemoved();
-        if (getReader()->getDetectionMode() == DetectionMode::REPEATING) {
-            switchState(MonitoringState::WAIT_FOR_CARD_INSERTION);
-        } else {
-            switchState(MonitoringState::WAIT_FOR_START_DETECTION);
-        }
-        break;
-
-    case InternalEvent::STOP_DETECT:
-        getReader()->processCardRemoved();
-        switchState(MonitoringState::WAIT_FOR_START_DETECTION);
-        break;
-
-    default:
-        mLogger->trace("Event ignored\n");
-        break;
-    }
-}
-
 } /* namespace service */
 } /* namespace core */
 } /* namespace keyple */
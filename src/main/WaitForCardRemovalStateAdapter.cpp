@@ -37,42 +37,6 @@ WaitForCardRemovalStateAdapter::WaitForCardRemovalStateAdapter(
 {
 }
 
-void
-WaitForCardRemovalStateAdapter::onEvent(const InternalEvent event)
-{
-    mLogger->trace(
-        "Internal event [%] received for reader [%] in current state [%]\n",
-        getReader()->getName(),
-        event,
-        getMonitoringState());
-
-    /* Process InternalEvent */
-    switch (event) {
-    case InternalEvent::CARD_REMOVED:
-        /*
-         * The card has been removed, we close all channels and return to the
-         * currentState of waiting for insertion We notify the application of
-         * the CARD_REMOVED event.
-         */
-        getReader()->processCardRemoved();
-        if (getReader()->getDetectionMode() == DetectionMode::REPEATING) {
-            switchState(MonitoringState::WAIT_FOR_CARD_INSERTION);
-        } else {
-            switchState(MonitoringState::WAIT_FOR_START_DETECTION);
-        }
-        break;
-
-    case InternalEvent::STOP_DETECT:
-        getReader()->processCardRemoved();
-        switchState(MonitoringState::WAIT_FOR_START_DETECTION);
-        break;
-
-    default:
-        mLogger->trace("Event ignored\n");
-        break;
-    }
-}
-
 } /* namespace service */
 } /* namespace core */
 } /* namespace keyple */
@@ -37,27 +37,6 @@ WaitForStartDetectStateAdapter::WaitForStartDetectStateAdapter(
 {
 }
 
-void
-WaitForStartDetectStateAdapter::onEvent(const InternalEvent event)
-{
-    mLogger->trace(
-        "Internal event [%] received for reader [%] in current state [%]\n",
-        getReader()->getName(),
-        event,
-        getMonitoringState());
-
-    /* Process InternalEvent */
-    switch (event) {
-    case InternalEvent::START_DETECT:
-        switchState(MonitoringState::WAIT_FOR_CARD_INSERTION);
-        break;
-
-    default:
-        mLogger->trace("Event ignored\n");
-        break;
-    }
-}
-
 } /* namespace service */
 } /* namespace core */
 } /* namespace keyple */
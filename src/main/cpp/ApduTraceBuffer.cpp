@@ -0,0 +1,217 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#include "keyple/core/service/cpp/ApduTraceBuffer.hpp"
+
+#include <algorithm>
+#include <iomanip>
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace cpp {
+
+namespace {
+
+/* Layout of mHeaderAndStatusWord: header bytes 0..4, status word, flag */
+const int STATUS_WORD_SHIFT = 40;
+const uint64_t STATUS_WORD_PRESENT = 1ULL << 56;
+
+} /* namespace */
+
+const std::size_t ApduTraceBuffer::CAPACITY;
+const std::size_t ApduTraceBuffer::HEADER_LENGTH;
+
+ApduTraceBuffer::ApduTraceBuffer()
+: mNextSequenceNumber(0)
+{
+    /* C++: std::atomic is not value-initialized by std::array */
+    for (Slot& slot : mSlots) {
+        slot.mVersion = 0;
+        slot.mCommandTimestampNanos = 0;
+        slot.mResponseTimestampNanos = 0;
+        slot.mHeaderAndStatusWord = 0;
+        slot.mLengths = 0;
+    }
+}
+
+void
+ApduTraceBuffer::record(
+    const std::vector<uint8_t>& command,
+    const std::vector<uint8_t>& response,
+    const uint64_t commandTimestampNanos,
+    const uint64_t responseTimestampNanos)
+{
+    const std::size_t length = response.size();
+    const int statusWord
+        = length >= 2
+              ? (response[length - 2] << 8) | response[length - 1]
+              : -1;
+
+    write(
+        command,
+        static_cast<uint32_t>(length),
+        statusWord,
+        commandTimestampNanos,
+        responseTimestampNanos);
+}
+
+void
+ApduTraceBuffer::recordFailure(
+    const std::vector<uint8_t>& command,
+    const uint64_t commandTimestampNanos,
+    const uint64_t failureTimestampNanos)
+{
+    write(command, 0, -1, commandTimestampNanos, failureTimestampNanos);
+}
+
+void
+ApduTraceBuffer::write(
+    const std::vector<uint8_t>& command,
+    const uint32_t responseLength,
+    const int statusWord,
+    const uint64_t commandTimestampNanos,
+    const uint64_t responseTimestampNanos)
+{
+    uint64_t headerAndStatusWord = 0;
+    const std::size_t headerLength = std::min(command.size(), HEADER_LENGTH);
+    for (std::size_t i = 0; i < headerLength; i++) {
+        headerAndStatusWord |= static_cast<uint64_t>(command[i]) << (8 * i);
+    }
+
+    if (statusWord >= 0) {
+        headerAndStatusWord
+            |= (static_cast<uint64_t>(statusWord) << STATUS_WORD_SHIFT)
+               | STATUS_WORD_PRESENT;
+    }
+
+    const uint64_t sequenceNumber
+        = mNextSequenceNumber.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = mSlots[sequenceNumber % CAPACITY];
+
+    slot.mVersion.store(2 * sequenceNumber + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.mCommandTimestampNanos.store(
+        commandTimestampNanos, std::memory_order_relaxed);
+    slot.mResponseTimestampNanos.store(
+        responseTimestampNanos, std::memory_order_relaxed);
+    slot.mHeaderAndStatusWord.store(
+        headerAndStatusWord, std::memory_order_relaxed);
+    slot.mLengths.store(
+        (static_cast<uint64_t>(responseLength) << 32)
+            | static_cast<uint32_t>(command.size()),
+        std::memory_order_relaxed);
+
+    slot.mVersion.store(2 * sequenceNumber + 2, std::memory_order_release);
+}
+
+std::vector<ApduTraceBuffer::Record>
+ApduTraceBuffer::snapshot() const
+{
+    const uint64_t end = mNextSequenceNumber.load(std::memory_order_acquire);
+    const uint64_t begin = end > CAPACITY ? end - CAPACITY : 0;
+
+    std::vector<Record> records;
+    records.reserve(static_cast<std::size_t>(end - begin));
+
+    for (uint64_t sequenceNumber = begin; sequenceNumber < end;
+         sequenceNumber++) {
+        const Slot& slot = mSlots[sequenceNumber % CAPACITY];
+        const uint64_t expectedVersion = 2 * sequenceNumber + 2;
+
+        if (slot.mVersion.load(std::memory_order_acquire) != expectedVersion) {
+            /* Still being written, or already overwritten */
+            continue;
+        }
+
+        const uint64_t commandTimestampNanos
+            = slot.mCommandTimestampNanos.load(std::memory_order_relaxed);
+        const uint64_t responseTimestampNanos
+            = slot.mResponseTimestampNanos.load(std::memory_order_relaxed);
+        const uint64_t headerAndStatusWord
+            = slot.mHeaderAndStatusWord.load(std::memory_order_relaxed);
+        const uint64_t lengths = slot.mLengths.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.mVersion.load(std::memory_order_relaxed) != expectedVersion) {
+            continue;
+        }
+
+        Record r;
+        r.sequenceNumber = sequenceNumber;
+        r.commandTimestampNanos = commandTimestampNanos;
+        r.responseTimestampNanos = responseTimestampNanos;
+        for (std::size_t i = 0; i < HEADER_LENGTH; i++) {
+            r.commandHeader[i]
+                = static_cast<uint8_t>(headerAndStatusWord >> (8 * i));
+        }
+        r.commandLength = static_cast<uint32_t>(lengths);
+        r.responseLength = static_cast<uint32_t>(lengths >> 32);
+        r.statusWord
+            = (headerAndStatusWord & STATUS_WORD_PRESENT)
+                  ? static_cast<int>(
+                      (headerAndStatusWord >> STATUS_WORD_SHIFT) & 0xFFFF)
+                  : -1;
+
+        records.push_back(r);
+    }
+
+    return records;
+}
+
+uint64_t
+ApduTraceBuffer::getRecordCount() const
+{
+    return mNextSequenceNumber.load(std::memory_order_relaxed);
+}
+
+std::ostream&
+operator<<(std::ostream& os, const ApduTraceBuffer::Record& r)
+{
+    const std::ios_base::fmtflags flags = os.flags();
+    const char fill = os.fill('0');
+
+    os << "APDU_TRACE_RECORD = {"
+       << "SEQUENCE_NUMBER = " << std::dec << r.sequenceNumber
+       << ", HEADER = " << std::hex << std::uppercase;
+
+    const std::size_t headerLength = std::min(
+        static_cast<std::size_t>(r.commandLength),
+        ApduTraceBuffer::HEADER_LENGTH);
+    for (std::size_t i = 0; i < headerLength; i++) {
+        os << std::setw(2) << static_cast<int>(r.commandHeader[i]);
+    }
+
+    os << ", COMMAND_LENGTH = " << std::dec << r.commandLength;
+
+    if (r.statusWord >= 0) {
+        os << ", STATUS_WORD = " << std::hex << std::setw(4) << r.statusWord
+           << ", RESPONSE_LENGTH = " << std::dec << r.responseLength;
+    } else {
+        os << ", STATUS_WORD = none";
+    }
+
+    os << ", DURATION_MICROS = "
+       << (r.responseTimestampNanos - r.commandTimestampNanos) / 1000 << "}";
+
+    os.fill(fill);
+    os.flags(flags);
+
+    return os;
+}
+
+} /* namespace cpp */
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
@@ -0,0 +1,60 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#include "keyple/core/service/cpp/CancellationToken.hpp"
+
+#include <chrono>
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace cpp {
+
+CancellationToken::CancellationToken()
+: mCancelled(false)
+{
+}
+
+void
+CancellationToken::cancel()
+{
+    {
+        const std::lock_guard<std::mutex> lock(mMutex);
+
+        mCancelled = true;
+    }
+
+    mCondition.notify_all();
+}
+
+bool
+CancellationToken::isCancellationRequested() const
+{
+    return mCancelled;
+}
+
+bool
+CancellationToken::waitForCancellation(const long timeoutMillis)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    return mCondition.wait_for(
+        lock, std::chrono::milliseconds(timeoutMillis), [this] {
+            return mCancelled.load();
+        });
+}
+
+} /* namespace cpp */
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
@@ -0,0 +1,76 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#include "keyple/core/service/cpp/CountDownLatch.hpp"
+
+#include <chrono>
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace cpp {
+
+CountDownLatch::CountDownLatch(const int count)
+: mCount(count)
+{
+}
+
+void
+CountDownLatch::countDown()
+{
+    {
+        const std::lock_guard<std::mutex> lock(mMutex);
+
+        if (mCount == 0) {
+            return;
+        }
+
+        if (--mCount > 0) {
+            return;
+        }
+    }
+
+    mCondition.notify_all();
+}
+
+int
+CountDownLatch::getCount() const
+{
+    const std::lock_guard<std::mutex> lock(mMutex);
+
+    return mCount;
+}
+
+void
+CountDownLatch::await()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    mCondition.wait(lock, [this] { return mCount == 0; });
+}
+
+bool
+CountDownLatch::await(const long timeoutMillis)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    return mCondition.wait_for(
+        lock, std::chrono::milliseconds(timeoutMillis), [this] {
+            return mCount == 0;
+        });
+}
+
+} /* namespace cpp */
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
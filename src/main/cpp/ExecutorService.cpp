@@ -13,78 +13,279 @@
 
 #include "keyple/core/service/cpp/ExecutorService.hpp"
 
+#include <chrono>
 #include <memory>
+#include <mutex>
+#include <vector>
 
-#include "keyple/core/service/AbstractObservableStateAdapter.hpp"
-#include "keyple/core/util/cpp/Thread.hpp"
+#include "keyple/core/util/KeypleAssert.hpp"
 
 namespace keyple {
 namespace core {
 namespace service {
 namespace cpp {
 
-using keyple::core::service::AbstractObservableStateAdapter;
-using keyple::core::util::cpp::Thread;
+using keyple::core::util::Assert;
 
 ExecutorService::ExecutorService()
-: mRunning(true)
-, mTerminated(false)
+: mState(std::make_shared<State>())
+, mThreadPool(nullptr)
+, mShutdownTimedOut(false)
 {
-    mThread = new std::thread(&ExecutorService::run, this);
+    mThread = std::thread(&ExecutorService::run, mState);
+}
+
+ExecutorService::ExecutorService(
+    std::shared_ptr<MonitoringThreadPool> threadPool)
+: mState(std::make_shared<State>())
+, mThreadPool(threadPool)
+, mShutdownTimedOut(false)
+{
+    Assert::getInstance().notNull(threadPool, "threadPool");
 }
 
 ExecutorService::~ExecutorService()
 {
-    mRunning = false;
+    bool shutdownTimedOut;
+
+    {
+        const std::lock_guard<std::mutex> lock(mState->mMutex);
+
+        shutdownTimedOut = mShutdownTimedOut;
+    }
 
-    while (!mTerminated) {
-        Thread::sleep(10);
+    if (!shutdownTimedOut) {
+        shutdown();
+        return;
+    }
+
+    /* The running job has already been given its chance to exit */
+    if (!shutdown(0) && mThread.joinable()) {
+        mThread.detach();
     }
 }
 
 void
-ExecutorService::run()
+ExecutorService::run(const std::shared_ptr<State> state)
 {
     /* Emulates a SingleThreadExecutor (e.g. only one thread at a time) */
 
-    while (mRunning) {
-        if (mPool.size()) {
-            /* Start first service and wait until completion */
-            std::shared_ptr<Job> job = mPool[0];
-            job->run();
+    std::unique_lock<std::mutex> lock(state->mMutex);
+
+    while (true) {
+        /* Sleep until a job is queued or the executor is shut down */
+        state->mCondition.wait(lock, [&state] {
+            return !state->mRunning || !state->mPool.empty();
+        });
 
-            /* Remove from vector */
-            mPool.erase(mPool.begin());
+        if (!state->mRunning) {
+            break;
         }
 
-        Thread::sleep(100);
+        const Task task = std::move(state->mPool.front());
+        state->mPool.pop_front();
+
+        /* Run job outside of the lock and wait until completion */
+        runTask(*state, lock, task);
     }
+}
 
-    mTerminated = true;
+void
+ExecutorService::drain(const bool blocking)
+{
+    std::unique_lock<std::mutex> lock(mState->mMutex);
+
+    while (mState->mRunning && !mState->mPool.empty()) {
+        /* A blocking job must not hold a worker shared by the other tasks */
+        if (!blocking && isBlocking(mState->mPool.front())) {
+            lock.unlock();
+            scheduleDrain(true);
+            return;
+        }
+
+        const Task task = std::move(mState->mPool.front());
+        mState->mPool.pop_front();
+
+        runTask(*mState, lock, task);
+    }
+
+    mState->mDrainScheduled = false;
+}
+
+bool
+ExecutorService::isBlocking(const Task& task)
+{
+    return task.mJob != nullptr && task.mJob->isBlocking();
+}
+
+void
+ExecutorService::scheduleDrain(const bool blocking)
+{
+    /* The task keeps the executor alive until it has been run */
+    const std::shared_ptr<ExecutorService> self = shared_from_this();
+    mThreadPool->execute(
+        [self, blocking] { self->drain(blocking); }, blocking);
+}
+
+void
+ExecutorService::runTask(
+    State& state, std::unique_lock<std::mutex>& lock, const Task& task)
+{
+    state.mTaskThreadId = std::this_thread::get_id();
+    state.mRunningJob = task.mJob;
+
+    lock.unlock();
+    task.mFunction();
+    lock.lock();
+
+    state.mTaskThreadId = std::thread::id();
+    state.mRunningJob = nullptr;
+
+    /* Wake up a pending shutdown() */
+    state.mIdleCondition.notify_all();
 }
 
 void
 ExecutorService::execute(std::shared_ptr<Job> job)
 {
-    mPool.push_back(job);
+    enqueue({[job] { job->runUnlessCancelled(); }, job});
+}
+
+void
+ExecutorService::execute(const std::function<void()>& task)
+{
+    enqueue({task, nullptr});
 }
 
-std::shared_ptr<Job>
+std::shared_ptr<JobFuture>
 ExecutorService::submit(std::shared_ptr<Job> job)
 {
-    mPool.push_back(job);
+    enqueue({[job] { job->runUnlessCancelled(); }, job});
 
-    return mPool.back();
+    return std::make_shared<JobFuture>(job);
+}
+
+void
+ExecutorService::enqueue(const Task& task)
+{
+    bool drainToSchedule = false;
+
+    {
+        const std::lock_guard<std::mutex> lock(mState->mMutex);
+
+        if (!mState->mRunning) {
+            return;
+        }
+
+        mState->mPool.push_back(task);
+
+        if (mThreadPool != nullptr && !mState->mDrainScheduled) {
+            mState->mDrainScheduled = true;
+            drainToSchedule = true;
+        }
+    }
+
+    if (mThreadPool == nullptr) {
+        mState->mCondition.notify_one();
+    } else if (drainToSchedule) {
+        scheduleDrain(isBlocking(task));
+    }
 }
 
 void
 ExecutorService::shutdown()
 {
-    mRunning = false;
+    shutdown(-1);
+}
+
+bool
+ExecutorService::shutdown(const long timeoutMillis)
+{
+    std::vector<std::shared_ptr<Job>> discardedJobs;
+    std::shared_ptr<Job> runningJob;
+
+    {
+        const std::lock_guard<std::mutex> lock(mState->mMutex);
+
+        mState->mRunning = false;
+
+        for (const auto& task : mState->mPool) {
+            if (task.mJob != nullptr) {
+                discardedJobs.push_back(task.mJob);
+            }
+        }
+        mState->mPool.clear();
+
+        runningJob = mState->mRunningJob;
+    }
+
+    mState->mCondition.notify_all();
+
+    /* Release the waiters of the discarded jobs, ask the running one to exit */
+    for (const auto& job : discardedJobs) {
+        job->cancel(false);
+    }
+
+    if (runningJob != nullptr && timeoutMillis >= 0) {
+        runningJob->cancel(true);
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mState->mMutex);
+
+        /* Wait for the running job to complete, unless called by the job */
+        if (mState->mTaskThreadId != std::this_thread::get_id()) {
+            const auto isIdle = [this] {
+                return mState->mTaskThreadId == std::thread::id();
+            };
+
+            if (timeoutMillis < 0) {
+                mState->mIdleCondition.wait(lock, isIdle);
+            } else if (!mState->mIdleCondition.wait_for(
+                           lock,
+                           std::chrono::milliseconds(timeoutMillis),
+                           isIdle)) {
+                mShutdownTimedOut = true;
+                return false;
+            }
+        }
+    }
+
+    if (mThreadPool != nullptr || !mThread.joinable()) {
+        return true;
+    }
+
+    if (mThread.get_id() == std::this_thread::get_id()) {
+        mThread.detach();
+    } else {
+        mThread.join();
+    }
+
+    return true;
+}
+
+bool
+ExecutorService::awaitIdle(const long timeoutMillis)
+{
+    std::unique_lock<std::mutex> lock(mState->mMutex);
 
-    while (!mTerminated) {
-        Thread::sleep(10);
+    /* A job cannot wait for itself */
+    if (mState->mTaskThreadId == std::this_thread::get_id()) {
+        return false;
     }
+
+    const auto isIdle = [this] {
+        return mState->mPool.empty()
+               && mState->mTaskThreadId == std::thread::id();
+    };
+
+    if (timeoutMillis < 0) {
+        mState->mIdleCondition.wait(lock, isIdle);
+        return true;
+    }
+
+    return mState->mIdleCondition.wait_for(
+        lock, std::chrono::milliseconds(timeoutMillis), isIdle);
 }
 
 } /* namespace cpp */
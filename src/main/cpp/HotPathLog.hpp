@@ -0,0 +1,49 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#pragma once
+
+/**
+ * Level-gated logging helpers for the APDU transmit path.
+ *
+ * <p>The log arguments are only evaluated when the corresponding level is
+ * enabled, so building the printable form of requests and responses costs
+ * nothing when the level is off.
+ *
+ * <p>C++: when the library is built with KEYPLE_SERVICE_DISABLE_HOT_PATH_LOGS
+ * defined (CMake option of the same name), the level checks become constant
+ * false and the trace/debug statements are removed by the compiler.
+ *
+ * @since 3.3.0
+ */
+#if defined(KEYPLE_SERVICE_DISABLE_HOT_PATH_LOGS)
+#define KEYPLE_SERVICE_TRACE_ENABLED(logger) (static_cast<void>(logger), false)
+#define KEYPLE_SERVICE_DEBUG_ENABLED(logger) (static_cast<void>(logger), false)
+#else
+#define KEYPLE_SERVICE_TRACE_ENABLED(logger) ((logger)->isTraceEnabled())
+#define KEYPLE_SERVICE_DEBUG_ENABLED(logger) ((logger)->isDebugEnabled())
+#endif
+
+#define KEYPLE_SERVICE_TRACE(logger, ...)                                      \
+    do {                                                                       \
+        if (KEYPLE_SERVICE_TRACE_ENABLED(logger)) {                            \
+            (logger)->trace(__VA_ARGS__);                                      \
+        }                                                                      \
+    } while (0)
+
+#define KEYPLE_SERVICE_DEBUG(logger, ...)                                      \
+    do {                                                                       \
+        if (KEYPLE_SERVICE_DEBUG_ENABLED(logger)) {                            \
+            (logger)->debug(__VA_ARGS__);                                      \
+        }                                                                      \
+    } while (0)
@@ -13,37 +13,41 @@
 
 #include "keyple/core/service/cpp/Job.hpp"
 
-#include <iostream>
+#include <chrono>
 #include <string>
 
-#include "keyple/core/util/cpp/exception/IllegalArgumentException.hpp"
-
 namespace keyple {
 namespace core {
 namespace service {
 namespace cpp {
 
-using keyple::core::util::cpp::exception::IllegalArgumentException;
-
 Job::Job(const std::string& name)
 : Thread(name)
 , mCancelled(false)
+, mStarted(false)
+, mCancellationToken(std::make_shared<CancellationToken>())
 {
 }
 
 bool
 Job::cancel(const bool mayInterruptIfRunning)
 {
-    if (mayInterruptIfRunning) {
-        throw IllegalArgumentException(
-            "Unsupported value for mayInterruptIfRunning (true)");
+    if (isDone()) {
+        return false;
     }
 
-    if (!isAlive()) {
-        return false;
+    {
+        const std::lock_guard<std::mutex> lock(mCompletionMutex);
+
+        mCancelled = true;
+    }
+
+    if (mayInterruptIfRunning) {
+        mCancellationToken->cancel();
     }
 
-    mCancelled = true;
+    /* A job cancelled before being started is done */
+    notifyCompletion();
 
     return true;
 }
@@ -51,7 +55,13 @@ Job::cancel(const bool mayInterruptIfRunning)
 bool
 Job::isDone()
 {
-    return mDone;
+    return mDone || (mCancelled && !mStarted);
+}
+
+bool
+Job::isBlocking() const
+{
+    return false;
 }
 
 bool
@@ -60,6 +70,121 @@ Job::isCancelled() const
     return mCancelled;
 }
 
+std::shared_ptr<CancellationToken>
+Job::getCancellationToken() const
+{
+    return mCancellationToken;
+}
+
+void
+Job::runUnlessCancelled()
+{
+    {
+        const std::lock_guard<std::mutex> lock(mCompletionMutex);
+
+        if (mCancelled) {
+            return;
+        }
+
+        mStarted = true;
+        mRunningThreadId = std::this_thread::get_id();
+    }
+
+    std::exception_ptr exception;
+
+    try {
+        run();
+    } catch (...) {
+        exception = std::current_exception();
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock(mCompletionMutex);
+
+        mRunningThreadId = std::thread::id();
+
+        if (exception != nullptr) {
+            mException = exception;
+            mDone = true;
+        }
+    }
+
+    notifyCompletion();
+}
+
+std::exception_ptr
+Job::getException()
+{
+    const std::lock_guard<std::mutex> lock(mCompletionMutex);
+
+    return mException;
+}
+
+void
+Job::addCompletionCallback(const std::function<void()>& callback)
+{
+    {
+        const std::lock_guard<std::mutex> lock(mCompletionMutex);
+
+        if (!isDone()) {
+            mCompletionCallbacks.push_back(callback);
+            return;
+        }
+    }
+
+    callback();
+}
+
+void
+Job::setRunningThread(const bool running)
+{
+    const std::lock_guard<std::mutex> lock(mCompletionMutex);
+
+    mRunningThreadId
+        = running ? std::this_thread::get_id() : std::thread::id();
+}
+
+bool
+Job::waitForCompletion(const long timeoutMillis)
+{
+    std::unique_lock<std::mutex> lock(mCompletionMutex);
+
+    if (mRunningThreadId == std::this_thread::get_id()) {
+        return isDone();
+    }
+
+    if (timeoutMillis < 0) {
+        mCompletionCondition.wait(lock, [this] { return isDone(); });
+        return true;
+    }
+
+    return mCompletionCondition.wait_for(
+        lock, std::chrono::milliseconds(timeoutMillis), [this] {
+            return isDone();
+        });
+}
+
+void
+Job::notifyCompletion()
+{
+    std::vector<std::function<void()>> callbacks;
+
+    {
+        /* Also prevents a lost wake-up between the check and the wait */
+        const std::lock_guard<std::mutex> lock(mCompletionMutex);
+
+        if (isDone()) {
+            callbacks.swap(mCompletionCallbacks);
+        }
+    }
+
+    mCompletionCondition.notify_all();
+
+    for (const auto& callback : callbacks) {
+        callback();
+    }
+}
+
 } /* namespace cpp */
 } /* namespace service */
 } /* namespace core */
@@ -0,0 +1,83 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#include "keyple/core/service/cpp/JobFuture.hpp"
+
+#include <exception>
+
+#include "keyple/core/util/KeypleAssert.hpp"
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace cpp {
+
+using keyple::core::util::Assert;
+
+JobFuture::JobFuture(std::shared_ptr<Job> job)
+: mJob(job)
+{
+    Assert::getInstance().notNull(job, "job");
+}
+
+bool
+JobFuture::cancel(const bool mayInterruptIfRunning)
+{
+    return mJob->cancel(mayInterruptIfRunning);
+}
+
+bool
+JobFuture::isCancelled() const
+{
+    return mJob->isCancelled();
+}
+
+bool
+JobFuture::isDone() const
+{
+    return mJob->isDone();
+}
+
+void
+JobFuture::wait() const
+{
+    mJob->waitForCompletion(-1);
+}
+
+void
+JobFuture::get() const
+{
+    wait();
+
+    const std::exception_ptr exception = mJob->getException();
+    if (exception != nullptr) {
+        std::rethrow_exception(exception);
+    }
+}
+
+void
+JobFuture::onCompletion(const std::function<void()>& callback)
+{
+    mJob->addCompletionCallback(callback);
+}
+
+std::shared_ptr<Job>
+JobFuture::getJob() const
+{
+    return mJob;
+}
+
+} /* namespace cpp */
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
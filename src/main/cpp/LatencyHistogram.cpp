@@ -0,0 +1,153 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#include "keyple/core/service/cpp/LatencyHistogram.hpp"
+
+#include <cmath>
+
+#include "keyple/core/util/cpp/exception/IllegalArgumentException.hpp"
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace cpp {
+
+using keyple::core::util::cpp::exception::IllegalArgumentException;
+
+const long long LatencyHistogram::MAX_TRACKABLE_VALUE
+    = (2LL << LatencyHistogram::MAX_MAGNITUDE) - 1;
+
+LatencyHistogram::LatencyHistogram()
+: mCount(0)
+, mMax(0)
+{
+    /* C++: std::atomic is not value-initialized by std::array */
+    for (std::atomic<long>& bucket : mBuckets) {
+        bucket = 0;
+    }
+}
+
+std::size_t
+LatencyHistogram::bucketIndex(const long long value)
+{
+    if (value < SUB_BUCKET_COUNT) {
+        return static_cast<std::size_t>(value);
+    }
+
+    if (value > MAX_TRACKABLE_VALUE) {
+        return BUCKET_COUNT - 1;
+    }
+
+    /* Position of the most significant bit */
+    int magnitude = 0;
+    for (long long v = value >> 1; v != 0; v >>= 1) {
+        magnitude++;
+    }
+
+    /* Keep the 5 most significant bits, the first one is always set */
+    const int shift = magnitude - 4;
+    const long long subBucket = (value >> shift) - SUB_BUCKET_COUNT / 2;
+
+    return static_cast<std::size_t>(
+        SUB_BUCKET_COUNT + (magnitude - 5) * (SUB_BUCKET_COUNT / 2)
+        + subBucket);
+}
+
+long long
+LatencyHistogram::bucketUpperBound(const std::size_t index)
+{
+    if (index < static_cast<std::size_t>(SUB_BUCKET_COUNT)) {
+        return static_cast<long long>(index);
+    }
+
+    const std::size_t offset = index - SUB_BUCKET_COUNT;
+    const int shift
+        = static_cast<int>(offset / (SUB_BUCKET_COUNT / 2)) + 1;
+    const long long subBucket
+        = SUB_BUCKET_COUNT / 2 + offset % (SUB_BUCKET_COUNT / 2);
+
+    return ((subBucket + 1) << shift) - 1;
+}
+
+void
+LatencyHistogram::record(const long long valueMicros)
+{
+    const long long value = valueMicros > 0 ? valueMicros : 0;
+
+    mBuckets[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    mCount.fetch_add(1, std::memory_order_relaxed);
+
+    long long max = mMax;
+    while (value > max && !mMax.compare_exchange_weak(max, value)) {
+        /* max has been reloaded, retry */
+    }
+}
+
+long
+LatencyHistogram::getCount() const
+{
+    return mCount;
+}
+
+long long
+LatencyHistogram::getMax() const
+{
+    return mMax;
+}
+
+long long
+LatencyHistogram::getValueAtPercentile(const double percentile) const
+{
+    if (percentile < 0 || percentile > 100) {
+        throw IllegalArgumentException("percentile must be in [0, 100]");
+    }
+
+    const long count = mCount;
+    if (count == 0) {
+        return 0;
+    }
+
+    long rank = static_cast<long>(std::ceil(percentile / 100 * count));
+    if (rank < 1) {
+        rank = 1;
+    }
+
+    const long long max = mMax;
+    long seen = 0;
+
+    for (std::size_t i = 0; i < BUCKET_COUNT; i++) {
+        seen += mBuckets[i];
+        if (seen >= rank) {
+            const long long upperBound = bucketUpperBound(i);
+            return upperBound < max ? upperBound : max;
+        }
+    }
+
+    /* Buckets cleared by a concurrent reset */
+    return max;
+}
+
+void
+LatencyHistogram::reset()
+{
+    for (std::atomic<long>& bucket : mBuckets) {
+        bucket = 0;
+    }
+    mCount = 0;
+    mMax = 0;
+}
+
+} /* namespace cpp */
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
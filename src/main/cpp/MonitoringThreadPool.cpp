@@ -0,0 +1,243 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#include "keyple/core/service/cpp/MonitoringThreadPool.hpp"
+
+#include <chrono>
+#include <exception>
+
+#include "keyple/core/util/cpp/exception/IllegalArgumentException.hpp"
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace cpp {
+
+using keyple::core::util::cpp::exception::IllegalArgumentException;
+
+const int MonitoringThreadPool::DEFAULT_MAX_THREAD_COUNT = 64;
+
+MonitoringThreadPool::MonitoringThreadPool(
+    const int coreThreadCount,
+    const long keepAliveMillis,
+    const int maxThreadCount)
+: mCoreThreadCount(coreThreadCount)
+, mMaxThreadCount(maxThreadCount)
+, mKeepAliveMillis(keepAliveMillis)
+, mBlockingTaskCount(0)
+, mStarvationReported(false)
+, mIdleWorkerCount(0)
+, mRunning(true)
+{
+    if (coreThreadCount < 1) {
+        throw IllegalArgumentException("coreThreadCount must be at least 1");
+    }
+
+    if (keepAliveMillis < 0) {
+        throw IllegalArgumentException("keepAliveMillis must be positive");
+    }
+
+    if (maxThreadCount < coreThreadCount) {
+        throw IllegalArgumentException(
+            "maxThreadCount must be greater than or equal to coreThreadCount");
+    }
+
+    const std::lock_guard<std::mutex> lock(mMutex);
+
+    for (int i = 0; i < mCoreThreadCount; i++) {
+        startWorker(true);
+    }
+}
+
+MonitoringThreadPool::~MonitoringThreadPool()
+{
+    shutdown();
+}
+
+void
+MonitoringThreadPool::startWorker(const bool isCore)
+{
+    /* Reclaim additional workers which have exited since the last call */
+    for (auto& worker : mExitedWorkers) {
+        worker.join();
+    }
+    mExitedWorkers.clear();
+
+    mIdleWorkerCount++;
+
+    std::thread worker(&MonitoringThreadPool::run, this, isCore);
+    const std::thread::id id = worker.get_id();
+    mWorkers.insert({id, std::move(worker)});
+}
+
+void
+MonitoringThreadPool::run(const bool isCore)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    /* The worker has been counted as idle by startWorker() */
+    while (true) {
+        const auto isWorkAvailable
+            = [this] { return !mRunning || !mTasks.empty(); };
+
+        bool hasWork = true;
+        if (isCore) {
+            mCondition.wait(lock, isWorkAvailable);
+        } else {
+            hasWork = mCondition.wait_for(
+                lock,
+                std::chrono::milliseconds(mKeepAliveMillis),
+                isWorkAvailable);
+        }
+
+        mIdleWorkerCount--;
+
+        if (!mRunning) {
+            break;
+        }
+
+        if (!hasWork) {
+            /* Keep-alive delay elapsed, the thread is joined later */
+            const auto it = mWorkers.find(std::this_thread::get_id());
+            mExitedWorkers.push_back(std::move(it->second));
+            mWorkers.erase(it);
+            break;
+        }
+
+        bool blocking;
+        {
+            /* Released before relocking, the task may own an executor */
+            const Task task = std::move(mTasks.front());
+            mTasks.pop_front();
+            blocking = task.mBlocking;
+
+            if (mTasks.empty()) {
+                mStarvationReported = false;
+            }
+
+            lock.unlock();
+
+            try {
+                task.mFunction();
+            } catch (const std::exception& e) {
+                mLogger->error(
+                    "Uncaught exception in monitoring task: %\n", e.what());
+            }
+        }
+
+        lock.lock();
+
+        if (blocking) {
+            mBlockingTaskCount--;
+        }
+
+        mIdleWorkerCount++;
+    }
+}
+
+void
+MonitoringThreadPool::execute(const std::function<void()>& task)
+{
+    execute(task, false);
+}
+
+void
+MonitoringThreadPool::execute(
+    const std::function<void()>& task, const bool blocking)
+{
+    {
+        const std::lock_guard<std::mutex> lock(mMutex);
+
+        if (!mRunning) {
+            return;
+        }
+
+        mTasks.push_back({task, blocking});
+
+        if (blocking) {
+            mBlockingTaskCount++;
+        }
+
+        /*
+         * Every queued task needs a worker of its own, within the maximum for
+         * the non blocking ones
+         */
+        if (mIdleWorkerCount < static_cast<int>(mTasks.size())) {
+            if (blocking
+                || static_cast<int>(mWorkers.size()) - mBlockingTaskCount
+                       < mMaxThreadCount) {
+                startWorker(false);
+            } else if (!mStarvationReported) {
+                mStarvationReported = true;
+                mLogger->warn(
+                    "All % workers are busy, tasks queued (% pending)\n",
+                    mMaxThreadCount,
+                    mTasks.size());
+            }
+        }
+    }
+
+    mCondition.notify_one();
+}
+
+void
+MonitoringThreadPool::shutdown()
+{
+    std::vector<std::thread> workers;
+
+    {
+        const std::lock_guard<std::mutex> lock(mMutex);
+
+        mRunning = false;
+        mTasks.clear();
+
+        for (auto& worker : mWorkers) {
+            workers.push_back(std::move(worker.second));
+        }
+        mWorkers.clear();
+
+        for (auto& worker : mExitedWorkers) {
+            workers.push_back(std::move(worker));
+        }
+        mExitedWorkers.clear();
+    }
+
+    mCondition.notify_all();
+
+    for (auto& worker : workers) {
+        if (worker.get_id() == std::this_thread::get_id()) {
+            worker.detach();
+        } else {
+            worker.join();
+        }
+    }
+}
+
+int
+MonitoringThreadPool::getThreadCount() const
+{
+    const std::lock_guard<std::mutex> lock(mMutex);
+
+    return static_cast<int>(mWorkers.size());
+}
+
+int
+MonitoringThreadPool::getMaxThreadCount() const
+{
+    return mMaxThreadCount;
+}
+
+} /* namespace cpp */
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
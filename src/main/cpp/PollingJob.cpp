@@ -0,0 +1,138 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#include "keyple/core/service/cpp/PollingJob.hpp"
+
+#include <memory>
+#include <string>
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace cpp {
+
+PollingJob::PollingJob(
+    const std::string& name,
+    std::shared_ptr<ExecutorService> executorService,
+    std::shared_ptr<TimerWheel> timerWheel)
+: Job(name)
+, mExecutorService(executorService)
+, mTimerWheel(timerWheel)
+, mPolling(true)
+, mPollRunning(false)
+, mPollCount(0)
+{
+}
+
+void
+PollingJob::poll()
+{
+    {
+        const std::lock_guard<std::mutex> lock(mMutex);
+
+        if (!isPolling()) {
+            return;
+        }
+
+        mPollRunning = true;
+    }
+
+    setRunningThread(true);
+    const bool pollAgain = pollOnce();
+    setRunningThread(false);
+
+    /* The policy is application code, not called with the lock held */
+    long delayMillis = 0;
+    if (pollAgain) {
+        delayMillis = getNextPollDelay(++mPollCount);
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock(mMutex);
+
+        mPollRunning = false;
+
+        /* Wait a bit */
+        if (pollAgain && isPolling()) {
+            scheduleNextPoll(delayMillis);
+        }
+    }
+
+    notifyCompletion();
+}
+
+void
+PollingJob::scheduleNextPoll(const long delayMillis)
+{
+    const std::weak_ptr<PollingJob> job = shared_from_this();
+    const std::shared_ptr<ExecutorService> executorService = mExecutorService;
+
+    /* The poll itself is run by the executor of the reader */
+    mNextPoll = mTimerWheel->schedule(
+        [job, executorService] {
+            executorService->execute([job] {
+                const auto pollingJob = job.lock();
+                if (pollingJob != nullptr) {
+                    pollingJob->poll();
+                }
+            });
+        },
+        delayMillis);
+}
+
+bool
+PollingJob::isPolling()
+{
+    return mPolling && !isCancelled()
+           && !getCancellationToken()->isCancellationRequested();
+}
+
+bool
+PollingJob::isDone()
+{
+    const std::lock_guard<std::mutex> lock(mMutex);
+
+    return !isPolling() && !mPollRunning;
+}
+
+bool
+PollingJob::endPolling()
+{
+    return mPolling.exchange(false)
+           && !getCancellationToken()->isCancellationRequested();
+}
+
+void
+PollingJob::stopPolling()
+{
+    getCancellationToken()->cancel();
+
+    {
+        const std::lock_guard<std::mutex> lock(mMutex);
+
+        if (mNextPoll != nullptr) {
+            mNextPoll->cancel();
+            mNextPoll = nullptr;
+        }
+    }
+
+    /* A poll may still be running, see waitForCompletion() */
+    notifyCompletion();
+
+    endPolling();
+}
+
+} /* namespace cpp */
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
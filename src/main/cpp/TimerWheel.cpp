@@ -0,0 +1,226 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#include "keyple/core/service/cpp/TimerWheel.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <limits>
+
+#include "keyple/core/util/cpp/exception/IllegalArgumentException.hpp"
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace cpp {
+
+using keyple::core::util::cpp::exception::IllegalArgumentException;
+
+/* TIMEOUT ---------------------------------------------------------------- */
+
+TimerWheel::Timeout::Timeout(
+    TimerWheel* wheel,
+    const std::function<void()>& task,
+    const uint64_t deadlineTick)
+: mWheel(wheel)
+, mTask(task)
+, mDeadlineTick(deadlineTick)
+, mScheduled(false)
+{
+}
+
+void
+TimerWheel::Timeout::cancel()
+{
+    const std::lock_guard<std::mutex> lock(mWheel->mMutex);
+
+    if (mScheduled) {
+        mWheel->unschedule(*this);
+    }
+}
+
+/* TIMER WHEEL ------------------------------------------------------------ */
+
+TimerWheel::TimerWheel(const long tickDurationMillis, const int wheelSize)
+: mTickDuration(tickDurationMillis)
+, mStartTime(std::chrono::steady_clock::now())
+, mPendingCount(0)
+, mLastTick(0)
+, mWakeUpTick(std::numeric_limits<uint64_t>::max())
+, mRunning(true)
+{
+    if (tickDurationMillis < 1) {
+        throw IllegalArgumentException("tickDurationMillis must be at least 1");
+    }
+
+    if (wheelSize < 1) {
+        throw IllegalArgumentException("wheelSize must be at least 1");
+    }
+
+    mSlots.resize(wheelSize);
+
+    mThread = std::thread(&TimerWheel::run, this);
+}
+
+TimerWheel::~TimerWheel()
+{
+    shutdown();
+}
+
+uint64_t
+TimerWheel::getCurrentTick() const
+{
+    return static_cast<uint64_t>(
+        (std::chrono::steady_clock::now() - mStartTime) / mTickDuration);
+}
+
+std::shared_ptr<TimerWheel::Timeout>
+TimerWheel::schedule(const std::function<void()>& task, const long delayMillis)
+{
+    const long tickMillis = static_cast<long>(mTickDuration.count());
+    const uint64_t ticks = static_cast<uint64_t>(
+        std::max(1L, (delayMillis + tickMillis - 1) / tickMillis));
+
+    const std::lock_guard<std::mutex> lock(mMutex);
+
+    const uint64_t deadlineTick
+        = std::max(getCurrentTick(), mLastTick) + ticks;
+    auto timeout = std::make_shared<Timeout>(this, task, deadlineTick);
+
+    if (!mRunning) {
+        return timeout;
+    }
+
+    Slot& slot = mSlots[deadlineTick % mSlots.size()];
+    timeout->mPosition = slot.insert(slot.end(), timeout);
+    timeout->mScheduled = true;
+    mPendingCount++;
+
+    /* Wake up the wheel thread if it sleeps past the new deadline */
+    if (deadlineTick < mWakeUpTick) {
+        mWakeUpTick = deadlineTick;
+        mCondition.notify_one();
+    }
+
+    return timeout;
+}
+
+void
+TimerWheel::unschedule(Timeout& timeout)
+{
+    mSlots[timeout.mDeadlineTick % mSlots.size()].erase(timeout.mPosition);
+    timeout.mScheduled = false;
+    timeout.mTask = nullptr;
+    mPendingCount--;
+}
+
+void
+TimerWheel::run()
+{
+    std::vector<std::function<void()>> expiredTasks;
+
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    while (mRunning) {
+        if (mPendingCount == 0) {
+            mWakeUpTick = std::numeric_limits<uint64_t>::max();
+            mCondition.wait(
+                lock, [this] { return !mRunning || mPendingCount > 0; });
+            continue;
+        }
+
+        /* Collect the expired tasks of the slots elapsed since last time */
+        const uint64_t currentTick = getCurrentTick();
+        const uint64_t elapsedSlots = std::min<uint64_t>(
+            currentTick - mLastTick, mSlots.size());
+
+        for (uint64_t tick = currentTick - elapsedSlots + 1;
+             tick <= currentTick;
+             tick++) {
+            Slot& slot = mSlots[tick % mSlots.size()];
+
+            for (auto it = slot.begin(); it != slot.end();) {
+                const std::shared_ptr<Timeout> timeout = *it++;
+
+                if (timeout->mDeadlineTick <= currentTick) {
+                    expiredTasks.push_back(std::move(timeout->mTask));
+                    unschedule(*timeout);
+                }
+            }
+        }
+
+        mLastTick = currentTick;
+
+        if (!expiredTasks.empty()) {
+            lock.unlock();
+
+            for (const auto& task : expiredTasks) {
+                try {
+                    task();
+                } catch (const std::exception& e) {
+                    mLogger->error(
+                        "Uncaught exception in timer task: %\n", e.what());
+                }
+            }
+
+            expiredTasks.clear();
+            lock.lock();
+
+            continue;
+        }
+
+        /* Sleep until the next occupied slot (or an earlier schedule) */
+        mWakeUpTick = std::numeric_limits<uint64_t>::max();
+        for (uint64_t i = 1; i <= mSlots.size(); i++) {
+            if (!mSlots[(currentTick + i) % mSlots.size()].empty()) {
+                mWakeUpTick = currentTick + i;
+                break;
+            }
+        }
+
+        mCondition.wait_until(lock, mStartTime + mWakeUpTick * mTickDuration);
+    }
+}
+
+void
+TimerWheel::shutdown()
+{
+    {
+        const std::lock_guard<std::mutex> lock(mMutex);
+
+        mRunning = false;
+
+        for (auto& slot : mSlots) {
+            while (!slot.empty()) {
+                unschedule(*slot.front());
+            }
+        }
+    }
+
+    mCondition.notify_all();
+
+    if (!mThread.joinable()) {
+        return;
+    }
+
+    if (mThread.get_id() == std::this_thread::get_id()) {
+        mThread.detach();
+    } else {
+        mThread.join();
+    }
+}
+
+} /* namespace cpp */
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
@@ -0,0 +1,84 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#include "keyple/core/service/cpp/TransactionArena.hpp"
+
+#include <cstdint>
+#include <utility>
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace cpp {
+
+TransactionArena::TransactionArena(const std::size_t blockSize)
+: mBlockSize(blockSize)
+, mCurrentBlock(0)
+, mOffset(0)
+{
+}
+
+void*
+TransactionArena::allocate(const std::size_t size, const std::size_t alignment)
+{
+    while (mCurrentBlock < mBlocks.size()) {
+        Block& block = mBlocks[mCurrentBlock];
+
+        const std::uintptr_t base
+            = reinterpret_cast<std::uintptr_t>(block.mData.get());
+        const std::uintptr_t aligned
+            = (base + mOffset + alignment - 1) & ~(alignment - 1);
+        const std::size_t offset = static_cast<std::size_t>(aligned - base);
+
+        if (offset + size <= block.mSize) {
+            mOffset = offset + size;
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        /* Continue in the next block (kept by a previous reset) */
+        mCurrentBlock++;
+        mOffset = 0;
+    }
+
+    /* Room for the alignment padding of oversized objects */
+    const std::size_t blockSize
+        = size + alignment > mBlockSize ? size + alignment : mBlockSize;
+
+    Block block;
+    block.mData = std::unique_ptr<char[]>(new char[blockSize]);
+    block.mSize = blockSize;
+    mBlocks.push_back(std::move(block));
+
+    mCurrentBlock = mBlocks.size() - 1;
+    mOffset = 0;
+
+    return allocate(size, alignment);
+}
+
+void
+TransactionArena::reset()
+{
+    mCurrentBlock = 0;
+    mOffset = 0;
+}
+
+std::size_t
+TransactionArena::getBlockCount() const
+{
+    return mBlocks.size();
+}
+
+} /* namespace cpp */
+} /* namespace service */
+} /* namespace core */
+} /* namespace keyple */
@@ -11,14 +11,20 @@
  * SPDX-License-Identifier: EPL-2.0                                           *
  ******************************************************************************/
 
+#include <atomic>
+#include <chrono>
+#include <future>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
 #include "keyple/core/util/cpp/exception/IllegalStateException.hpp"
+#include "keyple/core/util/cpp/exception/RuntimeException.hpp"
+#include "keypop/card/ReaderBrokenCommunicationException.hpp"
 
 #include "mock/AbstractReaderAdapterMock.hpp"
 #include "mock/CardRequestSpiMock.hpp"
@@ -26,11 +32,14 @@
 #include "mock/ReaderSpiMock.hpp"
 
 using keyple::core::util::cpp::exception::IllegalStateException;
+using keyple::core::util::cpp::exception::RuntimeException;
+using keypop::card::ReaderBrokenCommunicationException;
 
 using testing::_;
 using testing::AtMost;
 using testing::Return;
 using testing::ReturnRef;
+using testing::Throw;
 
 static const std::string PLUGIN_NAME = "plugin";
 static const std::string READER_NAME = "reader";
@@ -148,3 +157,161 @@ TEST(
 
     tearDown();
 }
+
+TEST(
+    AbstractReaderAdapterTest,
+    transmitCardRequestAsync_shouldInvoke_processCardRequest_onIoWorker)
+{
+    setUp();
+
+    readerAdapter->doRegister();
+
+    auto response = std::make_shared<CardResponseApiMock>();
+    EXPECT_CALL(*response.get(), isLogicalChannelOpen())
+        .WillRepeatedly(Return(true));
+    const std::vector<std::shared_ptr<ApduResponseApi>> empty;
+    EXPECT_CALL(*response.get(), getApduResponses())
+        .WillRepeatedly(ReturnRef(empty));
+
+    const std::thread::id callerId = std::this_thread::get_id();
+    std::thread::id workerId;
+    EXPECT_CALL(*readerAdapter.get(), processCardRequest(_, _))
+        .Times(1)
+        .WillOnce([&](const std::shared_ptr<CardRequestSpi>,
+                      const ChannelControl) {
+            workerId = std::this_thread::get_id();
+            return response;
+        });
+
+    auto future = readerAdapter->transmitCardRequestAsync(
+        cardRequestSpi, ChannelControl::KEEP_OPEN);
+
+    ASSERT_EQ(future.get(), response);
+    ASSERT_NE(workerId, callerId);
+
+    readerAdapter->doUnregister();
+    response.reset();
+
+    tearDown();
+}
+
+TEST(
+    AbstractReaderAdapterTest,
+    transmitCardRequestAsync_shouldProcessRequestsInSubmissionOrder)
+{
+    setUp();
+
+    readerAdapter->doRegister();
+
+    auto response = std::make_shared<CardResponseApiMock>();
+    EXPECT_CALL(*response.get(), isLogicalChannelOpen())
+        .WillRepeatedly(Return(true));
+    const std::vector<std::shared_ptr<ApduResponseApi>> empty;
+    EXPECT_CALL(*response.get(), getApduResponses())
+        .WillRepeatedly(ReturnRef(empty));
+
+    std::vector<std::shared_ptr<CardRequestSpi>> cardRequests;
+    for (int i = 0; i < 5; i++) {
+        cardRequests.push_back(std::make_shared<CardRequestSpiMock>());
+    }
+
+    /* Only written by the I/O worker, read once all the futures are done */
+    std::vector<std::shared_ptr<CardRequestSpi>> processedCardRequests;
+    EXPECT_CALL(*readerAdapter.get(), processCardRequest(_, _))
+        .Times(5)
+        .WillRepeatedly([&](const std::shared_ptr<CardRequestSpi> cardRequest,
+                            const ChannelControl) {
+            processedCardRequests.push_back(cardRequest);
+            return response;
+        });
+
+    std::vector<std::future<std::shared_ptr<CardResponseApi>>> futures;
+    for (const auto& cardRequest : cardRequests) {
+        futures.push_back(readerAdapter->transmitCardRequestAsync(
+            cardRequest, ChannelControl::KEEP_OPEN));
+    }
+    for (auto& future : futures) {
+        ASSERT_EQ(future.get(), response);
+    }
+
+    ASSERT_EQ(processedCardRequests, cardRequests);
+
+    readerAdapter->doUnregister();
+    response.reset();
+
+    tearDown();
+}
+
+TEST(
+    AbstractReaderAdapterTest,
+    transmitCardRequestAsync_whenProcessingFails_shouldRethrowFromFuture)
+{
+    setUp();
+
+    readerAdapter->doRegister();
+
+    EXPECT_CALL(*readerAdapter.get(), processCardRequest(_, _))
+        .Times(1)
+        .WillOnce(Throw(ReaderBrokenCommunicationException(
+            nullptr, false, "", std::make_shared<RuntimeException>())));
+
+    auto future = readerAdapter->transmitCardRequestAsync(
+        cardRequestSpi, ChannelControl::KEEP_OPEN);
+
+    EXPECT_THROW(future.get(), ReaderBrokenCommunicationException);
+
+    readerAdapter->doUnregister();
+
+    tearDown();
+}
+
+TEST(
+    AbstractReaderAdapterTest,
+    transmitCardRequest_whenAsyncRequestInProgress_shouldWaitForIt)
+{
+    setUp();
+
+    readerAdapter->doRegister();
+
+    auto response = std::make_shared<CardResponseApiMock>();
+    EXPECT_CALL(*response.get(), isLogicalChannelOpen())
+        .WillRepeatedly(Return(true));
+    const std::vector<std::shared_ptr<ApduResponseApi>> empty;
+    EXPECT_CALL(*response.get(), getApduResponses())
+        .WillRepeatedly(ReturnRef(empty));
+
+    std::promise<void> asyncStarted;
+    std::atomic<int> inProgressCount(0);
+    std::atomic<bool> overlapped(false);
+    bool isFirst = true;
+    EXPECT_CALL(*readerAdapter.get(), processCardRequest(_, _))
+        .Times(2)
+        .WillRepeatedly([&](const std::shared_ptr<CardRequestSpi>,
+                            const ChannelControl) {
+            if (++inProgressCount > 1) {
+                overlapped = true;
+            }
+            if (isFirst) {
+                isFirst = false;
+                asyncStarted.set_value();
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            }
+            inProgressCount--;
+            return response;
+        });
+
+    auto future = readerAdapter->transmitCardRequestAsync(
+        cardRequestSpi, ChannelControl::KEEP_OPEN);
+    asyncStarted.get_future().wait();
+
+    readerAdapter->transmitCardRequest(
+        cardRequestSpi, ChannelControl::KEEP_OPEN);
+
+    ASSERT_EQ(future.get(), response);
+    ASSERT_FALSE(overlapped);
+
+    readerAdapter->doUnregister();
+    response.reset();
+
+    tearDown();
+}
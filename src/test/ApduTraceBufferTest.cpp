@@ -0,0 +1,75 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#include <cstdint>
+#include <sstream>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "keyple/core/service/cpp/ApduTraceBuffer.hpp"
+
+using keyple::core::service::cpp::ApduTraceBuffer;
+
+TEST(ApduTraceBufferTest, record_shouldKeepHeaderStatusWordAndLengths)
+{
+    ApduTraceBuffer buffer;
+
+    buffer.record(
+        {0x00, 0xA4, 0x04, 0x00, 0x02, 0xA0, 0x00},
+        {0x6F, 0x00, 0x90, 0x00},
+        1000,
+        4000);
+    buffer.recordFailure({0x00, 0xB2}, 5000, 9000);
+
+    const std::vector<ApduTraceBuffer::Record> records = buffer.snapshot();
+
+    ASSERT_EQ(records.size(), 2u);
+
+    ASSERT_EQ(records[0].sequenceNumber, 0u);
+    ASSERT_EQ(records[0].commandHeader[1], 0xA4);
+    ASSERT_EQ(records[0].commandHeader[4], 0x02);
+    ASSERT_EQ(records[0].commandLength, 7u);
+    ASSERT_EQ(records[0].responseLength, 4u);
+    ASSERT_EQ(records[0].statusWord, 0x9000);
+    ASSERT_EQ(records[0].responseTimestampNanos, 4000u);
+
+    ASSERT_EQ(records[1].commandHeader[1], 0xB2);
+    ASSERT_EQ(records[1].commandHeader[2], 0x00);
+    ASSERT_EQ(records[1].commandLength, 2u);
+    ASSERT_EQ(records[1].statusWord, -1);
+
+    std::stringstream ss;
+    ss << records[0];
+    ASSERT_NE(ss.str().find("HEADER = 00A4040002"), std::string::npos);
+    ASSERT_NE(ss.str().find("STATUS_WORD = 9000"), std::string::npos);
+}
+
+TEST(ApduTraceBufferTest, record_whenFull_shouldKeepLatestRecords)
+{
+    ApduTraceBuffer buffer;
+
+    const uint64_t count = ApduTraceBuffer::CAPACITY + 10;
+    for (uint64_t i = 0; i < count; i++) {
+        buffer.record({0x00, static_cast<uint8_t>(i)}, {0x90, 0x00}, i, i);
+    }
+
+    const std::vector<ApduTraceBuffer::Record> records = buffer.snapshot();
+
+    ASSERT_EQ(buffer.getRecordCount(), count);
+    ASSERT_EQ(records.size(), ApduTraceBuffer::CAPACITY);
+    ASSERT_EQ(records.front().sequenceNumber, 10u);
+    ASSERT_EQ(records.back().sequenceNumber, count - 1);
+    ASSERT_EQ(records.back().commandHeader[1], static_cast<uint8_t>(count - 1));
+}
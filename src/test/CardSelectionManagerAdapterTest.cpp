@@ -11,24 +11,63 @@
  * SPDX-License-Identifier: EPL-2.0                                           *
  ******************************************************************************/
 
+#include <exception>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
 #include "keyple/core/service/CardSelectionManagerAdapter.hpp"
 #include "keyple/core/service/SmartCardServiceProvider.hpp"
+#include "keyple/core/util/cpp/exception/IllegalArgumentException.hpp"
 #include "keyple/core/util/cpp/exception/IllegalStateException.hpp"
+#include "keyple/core/util/cpp/exception/RuntimeException.hpp"
+#include "keypop/card/ReaderBrokenCommunicationException.hpp"
+#include "keypop/reader/ReaderCommunicationException.hpp"
+
+/* Mock */
+#include "mock/AbstractReaderAdapterMock.hpp"
+#include "mock/CardSelectionExtensionMock.hpp"
+#include "mock/CardSelectionRequestSpiMock.hpp"
+#include "mock/CardSelectionResponseApiMock.hpp"
+#include "mock/ReaderSpiMock.hpp"
+#include "mock/SmartCardMock.hpp"
 
 using keyple::core::service::CardSelectionManagerAdapter;
+using keyple::core::service::ParallelCardSelectionResult;
 using keyple::core::service::SmartCardServiceProvider;
+using keyple::core::util::cpp::exception::IllegalArgumentException;
 using keyple::core::util::cpp::exception::IllegalStateException;
+using keyple::core::util::cpp::exception::RuntimeException;
+using keypop::card::ReaderBrokenCommunicationException;
+using keypop::reader::CardReader;
+using keypop::reader::ReaderCommunicationException;
+
+using testing::_;
+using testing::Return;
+using testing::Throw;
 
 static std::shared_ptr<CardSelectionManagerAdapter> manager;
+static std::shared_ptr<ReaderSpiMock> readerSpi;
+
+static std::shared_ptr<AbstractReaderAdapterMock>
+createReader(const std::string& name)
+{
+    auto reader = std::make_shared<AbstractReaderAdapterMock>(
+        name,
+        std::dynamic_pointer_cast<KeypleReaderExtension>(readerSpi),
+        "plugin");
+    reader->doRegister();
+
+    return reader;
+}
 
 static void
 setUp()
 {
+    readerSpi = std::make_shared<ReaderSpiMock>();
     manager = std::dynamic_pointer_cast<CardSelectionManagerAdapter>(
         SmartCardServiceProvider::getService()
             ->getReaderApiFactory()
@@ -39,6 +78,7 @@ static void
 tearDown()
 {
     manager.reset();
+    readerSpi.reset();
 }
 
 // TEST(CardSelectionManagerAdapterTest,
@@ -99,3 +139,117 @@ TEST(
 
     tearDown();
 }
+
+TEST(
+    CardSelectionManagerAdapterTest,
+    processCardSelectionScenarioInParallel_whenParallelismIsZero_shouldThrowIAE)
+{
+    setUp();
+
+    EXPECT_THROW(
+        manager->processCardSelectionScenarioInParallel({}, 0),
+        IllegalArgumentException);
+
+    tearDown();
+}
+
+TEST(
+    CardSelectionManagerAdapterTest,
+    processCardSelectionScenarioInParallel_whenNoReader_shouldReturnNoResult)
+{
+    setUp();
+
+    ASSERT_TRUE(manager->processCardSelectionScenarioInParallel({}, 4).empty());
+
+    tearDown();
+}
+
+TEST(
+    CardSelectionManagerAdapterTest,
+    processCardSelectionScenarioInParallel_whenReaderTwice_shouldThrowIAE)
+{
+    setUp();
+
+    const std::shared_ptr<CardReader> reader = createReader("reader");
+
+    EXPECT_THROW(
+        manager->processCardSelectionScenarioInParallel({reader, reader}, 2),
+        IllegalArgumentException);
+
+    tearDown();
+}
+
+TEST(
+    CardSelectionManagerAdapterTest,
+    processCardSelectionScenarioInParallel_whenOneReaderFails_shouldGoOn)
+{
+    setUp();
+
+    auto cardSelectionRequest = std::make_shared<CardSelectionRequestSpiMock>();
+    auto cardSelectionExtension
+        = std::make_shared<CardSelectionExtensionMock>();
+    EXPECT_CALL(*cardSelectionExtension.get(), getCardSelectionRequest())
+        .WillOnce(Return(cardSelectionRequest));
+    auto smartCard = std::make_shared<SmartCardMock>();
+    EXPECT_CALL(*cardSelectionExtension.get(), parse(_))
+        .Times(2)
+        .WillRepeatedly(Return(smartCard));
+
+    manager->prepareSelection(
+        SmartCardServiceProvider::getService()
+            ->getReaderApiFactory()
+            ->createBasicCardSelector(),
+        cardSelectionExtension);
+
+    auto matchingResponse = std::make_shared<CardSelectionResponseApiMock>();
+    EXPECT_CALL(*matchingResponse.get(), hasMatched())
+        .WillRepeatedly(Return(true));
+    auto notMatchingResponse = std::make_shared<CardSelectionResponseApiMock>();
+    EXPECT_CALL(*notMatchingResponse.get(), hasMatched())
+        .WillRepeatedly(Return(false));
+
+    /* Readers 0 and 3 match, reader 1 does not, reader 2 fails */
+    std::vector<std::shared_ptr<AbstractReaderAdapterMock>> readerMocks;
+    std::vector<std::shared_ptr<CardReader>> readers;
+    for (int i = 0; i < 4; i++) {
+        readerMocks.push_back(createReader("reader" + std::to_string(i)));
+        readers.push_back(readerMocks.back());
+    }
+    EXPECT_CALL(*readerMocks[0].get(), processCardSelectionRequests(_, _, _, _))
+        .WillOnce(Return(std::vector<std::shared_ptr<CardSelectionResponseApi>>(
+            {matchingResponse})));
+    EXPECT_CALL(*readerMocks[1].get(), processCardSelectionRequests(_, _, _, _))
+        .WillOnce(Return(std::vector<std::shared_ptr<CardSelectionResponseApi>>(
+            {notMatchingResponse})));
+    EXPECT_CALL(*readerMocks[2].get(), processCardSelectionRequests(_, _, _, _))
+        .WillOnce(Throw(ReaderBrokenCommunicationException(
+            nullptr, false, "", std::make_shared<RuntimeException>())));
+    EXPECT_CALL(*readerMocks[3].get(), processCardSelectionRequests(_, _, _, _))
+        .WillOnce(Return(std::vector<std::shared_ptr<CardSelectionResponseApi>>(
+            {matchingResponse})));
+
+    const std::vector<std::shared_ptr<ParallelCardSelectionResult>> results
+        = manager->processCardSelectionScenarioInParallel(readers, 2);
+
+    ASSERT_EQ(results.size(), 4u);
+    for (std::size_t i = 0; i < results.size(); i++) {
+        ASSERT_EQ(results[i]->getReader(), readers[i]);
+    }
+
+    ASSERT_EQ(results[0]->getException(), nullptr);
+    ASSERT_EQ(
+        results[0]->getCardSelectionResult()->getActiveSelectionIndex(), 0);
+    ASSERT_EQ(results[1]->getException(), nullptr);
+    ASSERT_EQ(
+        results[1]->getCardSelectionResult()->getActiveSelectionIndex(), -1);
+    ASSERT_EQ(results[2]->getCardSelectionResult(), nullptr);
+    ASSERT_NE(results[2]->getException(), nullptr);
+    EXPECT_THROW(
+        std::rethrow_exception(results[2]->getException()),
+        ReaderCommunicationException);
+    ASSERT_EQ(results[3]->getException(), nullptr);
+    ASSERT_EQ(
+        results[3]->getCardSelectionResult()->getActiveSelectionIndex(), 0);
+
+    tearDown();
+}
@@ -0,0 +1,44 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#include <thread>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "keyple/core/service/cpp/CountDownLatch.hpp"
+
+using keyple::core::service::cpp::CountDownLatch;
+
+TEST(CountDownLatchTest, await_whenCountNotReached_shouldTimeOut)
+{
+    CountDownLatch latch(2);
+
+    latch.countDown();
+
+    ASSERT_FALSE(latch.await(20));
+    ASSERT_EQ(latch.getCount(), 1);
+}
+
+TEST(CountDownLatchTest, await_whenCountedDownByOtherThread_shouldReturn)
+{
+    CountDownLatch latch(1);
+
+    std::thread thread([&latch] { latch.countDown(); });
+
+    latch.await();
+    ASSERT_EQ(latch.getCount(), 0);
+    ASSERT_TRUE(latch.await(0));
+
+    thread.join();
+}
@@ -0,0 +1,417 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "keyple/core/service/cpp/CountDownLatch.hpp"
+#include "keyple/core/service/cpp/ExecutorService.hpp"
+#include "keyple/core/service/cpp/Job.hpp"
+#include "keyple/core/service/cpp/MonitoringThreadPool.hpp"
+#include "keyple/core/util/cpp/exception/IllegalArgumentException.hpp"
+#include "keyple/core/util/cpp/exception/IllegalStateException.hpp"
+
+using keyple::core::service::cpp::CountDownLatch;
+using keyple::core::service::cpp::ExecutorService;
+using keyple::core::service::cpp::Job;
+using keyple::core::service::cpp::JobFuture;
+using keyple::core::service::cpp::MonitoringThreadPool;
+using keyple::core::util::cpp::exception::IllegalArgumentException;
+using keyple::core::util::cpp::exception::IllegalStateException;
+
+class RecordingJob final : public Job {
+public:
+    RecordingJob(
+        const int id,
+        std::vector<int>& record,
+        std::mutex& mutex,
+        std::atomic<bool>* release = nullptr)
+    : Job("RecordingJob")
+    , mId(id)
+    , mRecord(record)
+    , mMutex(mutex)
+    , mRelease(release)
+    {
+    }
+
+    void execute() final
+    {
+        while (mRelease != nullptr && !*mRelease) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        const std::lock_guard<std::mutex> lock(mMutex);
+        mRecord.push_back(mId);
+    }
+
+private:
+    const int mId;
+    std::vector<int>& mRecord;
+    std::mutex& mMutex;
+    std::atomic<bool>* mRelease;
+};
+
+class SleepingJob final : public Job {
+public:
+    explicit SleepingJob(std::atomic<bool>& started)
+    : Job("SleepingJob")
+    , mStarted(started)
+    {
+    }
+
+    void execute() final
+    {
+        mStarted = true;
+        getCancellationToken()->waitForCancellation(60000);
+    }
+
+private:
+    std::atomic<bool>& mStarted;
+};
+
+class BlockingJob final : public Job {
+public:
+    BlockingJob(std::atomic<int>& started, std::atomic<bool>& release)
+    : Job("BlockingJob")
+    , mStarted(started)
+    , mRelease(release)
+    {
+    }
+
+    bool isBlocking() const final
+    {
+        return true;
+    }
+
+    void execute() final
+    {
+        mStarted++;
+        while (!mRelease) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+private:
+    std::atomic<int>& mStarted;
+    std::atomic<bool>& mRelease;
+};
+
+class FailingJob final : public Job {
+public:
+    FailingJob()
+    : Job("FailingJob")
+    {
+    }
+
+    void execute() final
+    {
+        throw IllegalStateException("Job failure");
+    }
+};
+
+static bool
+waitForSize(std::vector<int>& record, std::mutex& mutex, const size_t size)
+{
+    for (int i = 0; i < 1000; i++) {
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            if (record.size() >= size) {
+                return true;
+            }
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    return false;
+}
+
+TEST(ExecutorServiceTest, submit_whenDedicatedThread_shouldRunJobsInOrder)
+{
+    std::vector<int> record;
+    std::mutex mutex;
+    auto executorService = std::make_shared<ExecutorService>();
+
+    for (int i = 0; i < 5; i++) {
+        executorService->submit(
+            std::make_shared<RecordingJob>(i, record, mutex));
+    }
+
+    ASSERT_TRUE(waitForSize(record, mutex, 5));
+    ASSERT_EQ(record, std::vector<int>({0, 1, 2, 3, 4}));
+
+    executorService->shutdown();
+}
+
+TEST(ExecutorServiceTest, submit_whenSharedPool_shouldRunJobsInOrder)
+{
+    std::vector<int> record;
+    std::mutex mutex;
+    auto threadPool = std::make_shared<MonitoringThreadPool>(2, 100);
+    auto executorService = std::make_shared<ExecutorService>(threadPool);
+
+    for (int i = 0; i < 5; i++) {
+        executorService->submit(
+            std::make_shared<RecordingJob>(i, record, mutex));
+    }
+
+    ASSERT_TRUE(waitForSize(record, mutex, 5));
+    ASSERT_EQ(record, std::vector<int>({0, 1, 2, 3, 4}));
+
+    executorService->shutdown();
+    threadPool->shutdown();
+}
+
+TEST(ExecutorServiceTest, submit_whenAllPoolWorkersBusy_shouldGrowPool)
+{
+    std::vector<int> record;
+    std::mutex mutex;
+    std::atomic<bool> release(false);
+    auto threadPool = std::make_shared<MonitoringThreadPool>(1, 100);
+    auto executorService1 = std::make_shared<ExecutorService>(threadPool);
+    auto executorService2 = std::make_shared<ExecutorService>(threadPool);
+
+    /* Holds the only core worker */
+    executorService1->submit(
+        std::make_shared<RecordingJob>(1, record, mutex, &release));
+    executorService2->submit(std::make_shared<RecordingJob>(2, record, mutex));
+
+    ASSERT_TRUE(waitForSize(record, mutex, 1));
+    ASSERT_EQ(record, std::vector<int>({2}));
+    ASSERT_EQ(threadPool->getThreadCount(), 2);
+
+    release = true;
+
+    ASSERT_TRUE(waitForSize(record, mutex, 2));
+
+    executorService1->shutdown();
+    executorService2->shutdown();
+    threadPool->shutdown();
+}
+
+TEST(ExecutorServiceTest, submit_whenPoolAtMaximum_shouldQueueJobs)
+{
+    std::vector<int> record;
+    std::mutex mutex;
+    std::atomic<bool> release(false);
+    auto threadPool = std::make_shared<MonitoringThreadPool>(1, 100, 2);
+    auto executorService1 = std::make_shared<ExecutorService>(threadPool);
+    auto executorService2 = std::make_shared<ExecutorService>(threadPool);
+    auto executorService3 = std::make_shared<ExecutorService>(threadPool);
+
+    /* Hold both workers, the third job must wait for one of them */
+    executorService1->submit(
+        std::make_shared<RecordingJob>(1, record, mutex, &release));
+    executorService2->submit(
+        std::make_shared<RecordingJob>(2, record, mutex, &release));
+    executorService3->submit(std::make_shared<RecordingJob>(3, record, mutex));
+
+    ASSERT_FALSE(waitForSize(record, mutex, 1));
+    ASSERT_EQ(threadPool->getThreadCount(), 2);
+
+    release = true;
+
+    ASSERT_TRUE(waitForSize(record, mutex, 3));
+    ASSERT_EQ(threadPool->getThreadCount(), 2);
+
+    executorService1->shutdown();
+    executorService2->shutdown();
+    executorService3->shutdown();
+    threadPool->shutdown();
+}
+
+TEST(ExecutorServiceTest, submit_whenBlockingJobsBeyondMaximum_shouldRunAll)
+{
+    std::vector<int> record;
+    std::mutex mutex;
+    std::atomic<int> started(0);
+    std::atomic<bool> release(false);
+    auto threadPool = std::make_shared<MonitoringThreadPool>(1, 100, 1);
+    std::vector<std::shared_ptr<ExecutorService>> executorServices;
+
+    /* Each blocking job gets a worker of its own despite the maximum */
+    for (int i = 0; i < 3; i++) {
+        executorServices.push_back(
+            std::make_shared<ExecutorService>(threadPool));
+        executorServices.back()->submit(
+            std::make_shared<BlockingJob>(started, release));
+    }
+
+    /* The non blocking jobs still get the worker they share */
+    executorServices.push_back(std::make_shared<ExecutorService>(threadPool));
+    executorServices.back()->submit(
+        std::make_shared<RecordingJob>(4, record, mutex));
+
+    ASSERT_TRUE(waitForSize(record, mutex, 1));
+    for (int i = 0; i < 1000 && started < 3; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(started, 3);
+
+    release = true;
+
+    for (const auto& executorService : executorServices) {
+        executorService->shutdown();
+    }
+    threadPool->shutdown();
+}
+
+TEST(ExecutorServiceTest, constructor_whenMaxBelowCore_shouldThrow)
+{
+    ASSERT_THROW(
+        std::make_shared<MonitoringThreadPool>(2, 100, 1),
+        IllegalArgumentException);
+}
+
+TEST(ExecutorServiceTest, shutdown_whenTimeout_shouldCancelRunningJob)
+{
+    std::atomic<bool> started(false);
+    auto executorService = std::make_shared<ExecutorService>();
+    auto job = std::make_shared<SleepingJob>(started);
+    std::atomic<bool> pendingStarted(false);
+    auto pendingJob = std::make_shared<SleepingJob>(pendingStarted);
+
+    executorService->submit(job);
+    executorService->submit(pendingJob);
+    while (!started) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    ASSERT_TRUE(executorService->shutdown(5000));
+    ASSERT_TRUE(job->isDone());
+    ASSERT_TRUE(job->getCancellationToken()->isCancellationRequested());
+    ASSERT_TRUE(pendingJob->isCancelled());
+    ASSERT_TRUE(pendingJob->waitForCompletion(0));
+    ASSERT_FALSE(pendingStarted);
+}
+
+TEST(ExecutorServiceTest, destructor_whenShutdownTimedOut_shouldNotWaitAgain)
+{
+    std::vector<int> record;
+    std::mutex mutex;
+    std::atomic<bool> release(false);
+    auto executorService = std::make_shared<ExecutorService>();
+    auto job = std::make_shared<RecordingJob>(1, record, mutex, &release);
+
+    /* The job ignores its cancellation token */
+    executorService->submit(job);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    ASSERT_FALSE(executorService->shutdown(20));
+
+    const auto start = std::chrono::steady_clock::now();
+    executorService.reset();
+    ASSERT_LT(
+        std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+
+    release = true;
+
+    ASSERT_TRUE(job->waitForCompletion(5000));
+    ASSERT_EQ(record, std::vector<int>({1}));
+}
+
+TEST(ExecutorServiceTest, waitForCompletion_whenNotCancelled_shouldTimeOut)
+{
+    std::atomic<bool> started(false);
+    auto executorService = std::make_shared<ExecutorService>();
+    auto job = std::make_shared<SleepingJob>(started);
+
+    executorService->submit(job);
+
+    ASSERT_FALSE(job->waitForCompletion(20));
+    ASSERT_TRUE(job->cancel(true));
+    ASSERT_TRUE(job->waitForCompletion(5000));
+
+    executorService->shutdown();
+}
+
+TEST(ExecutorServiceTest, submit_whenJobCompletes_shouldReleaseWaiters)
+{
+    std::vector<int> record;
+    std::mutex mutex;
+    std::atomic<bool> release(false);
+    std::atomic<int> callbackCount(0);
+    CountDownLatch callbackLatch(1);
+    auto executorService = std::make_shared<ExecutorService>();
+
+    std::shared_ptr<JobFuture> future = executorService->submit(
+        std::make_shared<RecordingJob>(1, record, mutex, &release));
+    future->onCompletion([&callbackCount, &callbackLatch] {
+        callbackCount++;
+        callbackLatch.countDown();
+    });
+
+    ASSERT_EQ(
+        future->wait_for(std::chrono::milliseconds(20)),
+        std::future_status::timeout);
+    ASSERT_EQ(callbackCount, 0);
+
+    release = true;
+    future->wait();
+
+    /* The callback runs on the worker, possibly after the waiters wake up */
+    ASSERT_TRUE(future->isDone());
+    ASSERT_TRUE(callbackLatch.await(1000));
+    ASSERT_EQ(callbackCount, 1);
+    ASSERT_EQ(record, std::vector<int>({1}));
+
+    /* Registered after completion: invoked immediately */
+    future->onCompletion([&callbackCount] { callbackCount++; });
+    ASSERT_EQ(callbackCount, 2);
+
+    executorService->shutdown();
+}
+
+TEST(ExecutorServiceTest, submit_whenJobThrows_shouldRethrowFromGet)
+{
+    auto executorService = std::make_shared<ExecutorService>();
+
+    std::shared_ptr<JobFuture> future
+        = executorService->submit(std::make_shared<FailingJob>());
+
+    ASSERT_THROW(future->get(), IllegalStateException);
+    ASSERT_TRUE(future->isDone());
+
+    executorService->shutdown();
+}
+
+TEST(ExecutorServiceTest, awaitIdle_whenJobsPending_shouldWaitForThem)
+{
+    std::vector<int> record;
+    std::mutex mutex;
+    std::atomic<bool> release(false);
+    auto threadPool = std::make_shared<MonitoringThreadPool>(1, 100);
+    auto executorService = std::make_shared<ExecutorService>(threadPool);
+
+    executorService->execute(
+        std::make_shared<RecordingJob>(0, record, mutex, &release));
+    executorService->execute(std::make_shared<RecordingJob>(1, record, mutex));
+
+    ASSERT_FALSE(executorService->awaitIdle(20));
+
+    release = true;
+
+    ASSERT_TRUE(executorService->awaitIdle(5000));
+    ASSERT_EQ(record, std::vector<int>({0, 1}));
+
+    executorService->shutdown();
+    threadPool->shutdown();
+}
@@ -0,0 +1,66 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#include <limits>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "keyple/core/service/ExponentialBackoffPollingPolicy.hpp"
+#include "keyple/core/util/cpp/exception/IllegalArgumentException.hpp"
+
+using keyple::core::service::ExponentialBackoffPollingPolicy;
+using keyple::core::util::cpp::exception::IllegalArgumentException;
+
+TEST(
+    ExponentialBackoffPollingPolicyTest,
+    getNextPollDelay_whenWaitingForInsertion_shouldBackOff)
+{
+    ExponentialBackoffPollingPolicy policy(10, 100, 2);
+
+    ASSERT_EQ(policy.getNextPollDelay(true, 1, 50), 10);
+    ASSERT_EQ(policy.getNextPollDelay(true, 2, 50), 10);
+    ASSERT_EQ(policy.getNextPollDelay(true, 3, 50), 20);
+    ASSERT_EQ(policy.getNextPollDelay(true, 5, 50), 40);
+    ASSERT_EQ(policy.getNextPollDelay(true, 7, 50), 80);
+    ASSERT_EQ(policy.getNextPollDelay(true, 9, 50), 100);
+    ASSERT_EQ(policy.getNextPollDelay(true, 1000000, 50), 100);
+}
+
+TEST(
+    ExponentialBackoffPollingPolicyTest,
+    getNextPollDelay_whenWaitingForRemoval_shouldReturnDefaultDelay)
+{
+    ExponentialBackoffPollingPolicy policy(10, 100, 2);
+
+    ASSERT_EQ(policy.getNextPollDelay(false, 9, 50), 50);
+}
+
+TEST(
+    ExponentialBackoffPollingPolicyTest,
+    getNextPollDelay_whenMaxNearLongMax_shouldNotOverflow)
+{
+    const long maxDelayMillis = std::numeric_limits<long>::max();
+    ExponentialBackoffPollingPolicy policy(
+        maxDelayMillis / 2 + 1, maxDelayMillis, 1);
+
+    ASSERT_EQ(policy.getNextPollDelay(true, 1, 50), maxDelayMillis / 2 + 1);
+    ASSERT_EQ(policy.getNextPollDelay(true, 2, 50), maxDelayMillis);
+    ASSERT_EQ(policy.getNextPollDelay(true, 1000000, 50), maxDelayMillis);
+}
+
+TEST(ExponentialBackoffPollingPolicyTest, constructor_whenMaxTooLow_shouldIAE)
+{
+    EXPECT_THROW(
+        ExponentialBackoffPollingPolicy(10, 5, 1), IllegalArgumentException);
+}
@@ -0,0 +1,68 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "keyple/core/service/cpp/LatencyHistogram.hpp"
+#include "keyple/core/util/cpp/exception/IllegalArgumentException.hpp"
+
+using keyple::core::service::cpp::LatencyHistogram;
+using keyple::core::util::cpp::exception::IllegalArgumentException;
+
+TEST(LatencyHistogramTest, getValueAtPercentile_whenEmpty_shouldReturnZero)
+{
+    LatencyHistogram histogram;
+
+    ASSERT_EQ(histogram.getCount(), 0);
+    ASSERT_EQ(histogram.getMax(), 0);
+    ASSERT_EQ(histogram.getValueAtPercentile(99), 0);
+}
+
+TEST(LatencyHistogramTest, getValueAtPercentile_shouldBeWithinBucketPrecision)
+{
+    LatencyHistogram histogram;
+
+    for (long long value = 1; value <= 10000; value++) {
+        histogram.record(value);
+    }
+
+    ASSERT_EQ(histogram.getCount(), 10000);
+    ASSERT_EQ(histogram.getMax(), 10000);
+
+    const long long p50 = histogram.getValueAtPercentile(50);
+    ASSERT_GE(p50, 5000);
+    ASSERT_LE(p50, 5000 + 5000 / 16);
+
+    const long long p99 = histogram.getValueAtPercentile(99);
+    ASSERT_GE(p99, 9900);
+    ASSERT_LE(p99, 10000);
+
+    ASSERT_EQ(histogram.getValueAtPercentile(100), 10000);
+}
+
+TEST(LatencyHistogramTest, record_whenValueIsOutOfRange_shouldBeClamped)
+{
+    LatencyHistogram histogram;
+
+    histogram.record(-5);
+    histogram.record(LatencyHistogram::MAX_TRACKABLE_VALUE * 2);
+
+    ASSERT_EQ(histogram.getValueAtPercentile(50), 0);
+    ASSERT_EQ(histogram.getMax(), LatencyHistogram::MAX_TRACKABLE_VALUE * 2);
+    ASSERT_THROW(histogram.getValueAtPercentile(101), IllegalArgumentException);
+
+    histogram.reset();
+
+    ASSERT_EQ(histogram.getCount(), 0);
+}
@@ -22,6 +22,7 @@
 #include "keyple/core/plugin/CardIOException.hpp"
 #include "keyple/core/plugin/ReaderIOException.hpp"
 #include "keyple/core/plugin/spi/reader/ReaderSpi.hpp"
+#include "keyple/core/service/ApduResponseAdapter.hpp"
 #include "keyple/core/service/BasicCardSelectorAdapter.hpp"
 #include "keyple/core/service/LocalConfigurableReaderAdapter.hpp"
 #include "keyple/core/service/LocalReaderAdapter.hpp"
@@ -41,6 +42,7 @@
 
 /* Mock */
 #include "mock/ApduRequestSpiMock.hpp"
+#include "mock/BatchTransmitReaderSpiMock.hpp"
 #include "mock/CardRequestSpiMock.hpp"
 #include "mock/CardSelectionRequestSpiMock.hpp"
 #include "mock/ConfigurableReaderSpiMock.hpp"
@@ -52,7 +54,9 @@ using keyple::core::common::KeypleReaderExtension;
 using keyple::core::plugin::CardIOException;
 using keyple::core::plugin::ReaderIOException;
 using keyple::core::plugin::spi::reader::ReaderSpi;
+using keyple::core::service::ApduResponseAdapter;
 using keyple::core::service::BasicCardSelectorAdapter;
+using keyple::core::service::CardRequestResult;
 using keyple::core::service::LocalConfigurableReaderAdapter;
 using keyple::core::service::LocalReaderAdapter;
 using keyple::core::service::MultiSelectionProcessing;
@@ -726,6 +730,282 @@ TEST(LocalReaderAdapterTest, transmitCardRequest_isCase4)
     tearDown();
 }
 
+TEST(LocalReaderAdapterTest, transmitCardRequest_withSW6CXX_shouldReplayWithLe)
+{
+    setUp();
+
+    std::vector<uint8_t> requestApdu = HexUtil::toByteArray("00B2010400");
+    const std::vector<uint8_t> wrongLeRApdu = HexUtil::toByteArray("6C04");
+    const std::vector<uint8_t> replayApdu
+        = HexUtil::toByteArray("00B2010404");
+    const std::vector<uint8_t> responseApdu
+        = HexUtil::toByteArray("112233449000");
+
+    EXPECT_CALL(*apduRequestSpi.get(), getApdu())
+        .WillRepeatedly(Return(requestApdu));
+    EXPECT_CALL(*readerSpi.get(), transmitApdu(requestApdu))
+        .WillOnce(Return(wrongLeRApdu));
+    EXPECT_CALL(*readerSpi.get(), transmitApdu(replayApdu))
+        .WillOnce(Return(responseApdu));
+
+    LocalReaderAdapter localReaderAdapter(readerSpi, PLUGIN_NAME);
+    localReaderAdapter.doRegister();
+    auto response = localReaderAdapter.transmitCardRequest(
+        cardRequestSpi, ChannelControl::CLOSE_AFTER);
+
+    ASSERT_EQ(response->getApduResponses()[0]->getApdu(), responseApdu);
+
+    tearDown();
+}
+
+TEST(
+    LocalReaderAdapterTest,
+    transmitCardRequest_withChainedSW61XX_shouldConcatenateResponses)
+{
+    setUp();
+
+    std::vector<uint8_t> requestApdu = HexUtil::toByteArray("00B2010400");
+    const std::vector<uint8_t> firstChunkRApdu
+        = HexUtil::toByteArray("11226102");
+    const std::vector<uint8_t> getResponseCApdu
+        = HexUtil::toByteArray("00C0000002");
+    const std::vector<uint8_t> lastChunkRApdu
+        = HexUtil::toByteArray("33449000");
+
+    EXPECT_CALL(*apduRequestSpi.get(), getApdu())
+        .WillRepeatedly(Return(requestApdu));
+    EXPECT_CALL(*readerSpi.get(), transmitApdu(requestApdu))
+        .WillOnce(Return(firstChunkRApdu));
+    EXPECT_CALL(*readerSpi.get(), transmitApdu(getResponseCApdu))
+        .WillOnce(Return(lastChunkRApdu));
+
+    LocalReaderAdapter localReaderAdapter(readerSpi, PLUGIN_NAME);
+    localReaderAdapter.doRegister();
+    auto response = localReaderAdapter.transmitCardRequest(
+        cardRequestSpi, ChannelControl::CLOSE_AFTER);
+
+    const auto apduResponse = std::dynamic_pointer_cast<ApduResponseAdapter>(
+        response->getApduResponses()[0]);
+    ASSERT_EQ(apduResponse->getApdu(), HexUtil::toByteArray("112233449000"));
+    ASSERT_EQ(apduResponse->getExtraRoundTripCount(), 1);
+
+    /* Both exchanges are in the APDU trace */
+    const auto trace = localReaderAdapter.getApduTrace();
+    ASSERT_EQ(trace.size(), 2u);
+    ASSERT_EQ(trace[0].commandHeader[1], 0xB2);
+    ASSERT_EQ(trace[0].statusWord, 0x6102);
+    ASSERT_EQ(trace[1].commandHeader[1], 0xC0);
+    ASSERT_EQ(trace[1].statusWord, 0x9000);
+    ASSERT_EQ(trace[1].responseLength, 4u);
+
+    tearDown();
+}
+
+TEST(
+    LocalReaderAdapterTest,
+    transmitCardRequest_withBatchTransmitReader_shouldSendApdusInOneExchange)
+{
+    setUp();
+
+    const std::vector<uint8_t> requestApdu = HexUtil::toByteArray("00B2010400");
+    const std::vector<uint8_t> responseApdu
+        = HexUtil::toByteArray("11229000");
+
+    EXPECT_CALL(*apduRequestSpi.get(), getApdu())
+        .WillRepeatedly(Return(requestApdu));
+    apduRequests.push_back(apduRequestSpi);
+
+    auto batchReaderSpi = std::make_shared<BatchTransmitReaderSpiMock>();
+    EXPECT_CALL(*batchReaderSpi.get(), getName())
+        .WillRepeatedly(ReturnRef(READER_NAME));
+    EXPECT_CALL(*batchReaderSpi.get(), isPhysicalChannelOpen())
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*batchReaderSpi.get(), transmitApdu(_)).Times(0);
+    EXPECT_CALL(
+        *batchReaderSpi.get(),
+        transmitApdus(std::vector<std::vector<uint8_t>>(2, requestApdu)))
+        .WillOnce(Return(std::vector<std::vector<uint8_t>>(2, responseApdu)));
+
+    LocalReaderAdapter localReaderAdapter(batchReaderSpi, PLUGIN_NAME);
+    localReaderAdapter.doRegister();
+    auto response = localReaderAdapter.transmitCardRequest(
+        cardRequestSpi, ChannelControl::KEEP_OPEN);
+
+    ASSERT_EQ(response->getApduResponses().size(), 2u);
+    ASSERT_EQ(response->getApduResponses()[1]->getApdu(), responseApdu);
+
+    tearDown();
+}
+
+TEST(
+    LocalReaderAdapterTest,
+    tryTransmitCardRequest_withBatchReader_whenUnsuccessfulSW_shouldStop)
+{
+    setUp();
+
+    const std::vector<uint8_t> requestApdu = HexUtil::toByteArray("00B2010400");
+
+    EXPECT_CALL(*apduRequestSpi.get(), getApdu())
+        .WillRepeatedly(Return(requestApdu));
+    apduRequests.push_back(apduRequestSpi);
+    apduRequests.push_back(apduRequestSpi);
+    EXPECT_CALL(*cardRequestSpi.get(), stopOnUnsuccessfulStatusWord())
+        .WillRepeatedly(Return(true));
+
+    /* The reader stops after the first response which is not 9000 */
+    auto batchReaderSpi = std::make_shared<BatchTransmitReaderSpiMock>();
+    EXPECT_CALL(*batchReaderSpi.get(), getName())
+        .WillRepeatedly(ReturnRef(READER_NAME));
+    EXPECT_CALL(*batchReaderSpi.get(), isPhysicalChannelOpen())
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*batchReaderSpi.get(), transmitApdu(_)).Times(0);
+    EXPECT_CALL(*batchReaderSpi.get(), transmitApdus(_))
+        .WillOnce(Return(std::vector<std::vector<uint8_t>>(
+            {HexUtil::toByteArray("11229000"), HexUtil::toByteArray("6A82")})));
+
+    LocalReaderAdapter localReaderAdapter(batchReaderSpi, PLUGIN_NAME);
+    localReaderAdapter.doRegister();
+    const CardRequestResult result = localReaderAdapter.tryTransmitCardRequest(
+        cardRequestSpi, ChannelControl::KEEP_OPEN);
+
+    ASSERT_EQ(
+        result.getStatus(), CardRequestResult::Status::UNEXPECTED_STATUS_WORD);
+    ASSERT_FALSE(result.isCardResponseComplete());
+    ASSERT_EQ(result.getCardResponse()->getApduResponses().size(), 2u);
+    ASSERT_EQ(
+        result.getCardResponse()->getApduResponses()[1]->getStatusWord(),
+        0x6A82);
+
+    tearDown();
+}
+
+TEST(
+    LocalReaderAdapterTest,
+    transmitCardRequest_withBatchReader_whenNoStopOnUnsuccessfulSW_shouldGoOn)
+{
+    setUp();
+
+    const std::vector<uint8_t> requestApdu = HexUtil::toByteArray("00B2010400");
+    const std::vector<uint8_t> responseApdu
+        = HexUtil::toByteArray("11229000");
+
+    EXPECT_CALL(*apduRequestSpi.get(), getApdu())
+        .WillRepeatedly(Return(requestApdu));
+    apduRequests.push_back(apduRequestSpi);
+    apduRequests.push_back(apduRequestSpi);
+
+    /* The remaining commands are sent in a second batch */
+    auto batchReaderSpi = std::make_shared<BatchTransmitReaderSpiMock>();
+    EXPECT_CALL(*batchReaderSpi.get(), getName())
+        .WillRepeatedly(ReturnRef(READER_NAME));
+    EXPECT_CALL(*batchReaderSpi.get(), isPhysicalChannelOpen())
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*batchReaderSpi.get(), transmitApdu(_)).Times(0);
+    EXPECT_CALL(
+        *batchReaderSpi.get(),
+        transmitApdus(std::vector<std::vector<uint8_t>>(3, requestApdu)))
+        .WillOnce(Return(std::vector<std::vector<uint8_t>>(
+            {HexUtil::toByteArray("6A82")})));
+    EXPECT_CALL(
+        *batchReaderSpi.get(),
+        transmitApdus(std::vector<std::vector<uint8_t>>(2, requestApdu)))
+        .WillOnce(Return(std::vector<std::vector<uint8_t>>(2, responseApdu)));
+
+    LocalReaderAdapter localReaderAdapter(batchReaderSpi, PLUGIN_NAME);
+    localReaderAdapter.doRegister();
+    auto response = localReaderAdapter.transmitCardRequest(
+        cardRequestSpi, ChannelControl::KEEP_OPEN);
+
+    ASSERT_EQ(response->getApduResponses().size(), 3u);
+    ASSERT_EQ(response->getApduResponses()[0]->getStatusWord(), 0x6A82);
+    ASSERT_EQ(response->getApduResponses()[2]->getApdu(), responseApdu);
+
+    tearDown();
+}
+
+TEST(
+    LocalReaderAdapterTest,
+    transmitCardRequest_withBatchReader_shouldEndBatchWithCase4Command)
+{
+    setUp();
+
+    const std::vector<uint8_t> requestApdu = HexUtil::toByteArray("00B2010400");
+    const std::vector<uint8_t> case4RequestApdu
+        = HexUtil::toByteArray("00A4040002123400");
+    const std::vector<uint8_t> responseApdu
+        = HexUtil::toByteArray("11229000");
+
+    auto case4ApduRequestSpi = std::make_shared<ApduRequestSpiMock>();
+    EXPECT_CALL(*case4ApduRequestSpi.get(), getSuccessfulStatusWords())
+        .WillRepeatedly(ReturnRef(ok_sw));
+    EXPECT_CALL(*case4ApduRequestSpi.get(), getInfo())
+        .WillRepeatedly(ReturnRef(info));
+    EXPECT_CALL(*case4ApduRequestSpi.get(), getApdu())
+        .WillRepeatedly(Return(case4RequestApdu));
+
+    EXPECT_CALL(*apduRequestSpi.get(), getApdu())
+        .WillRepeatedly(Return(requestApdu));
+    apduRequests.push_back(case4ApduRequestSpi);
+    apduRequests.push_back(apduRequestSpi);
+
+    /* The command following the case 4 one is sent alone */
+    auto batchReaderSpi = std::make_shared<BatchTransmitReaderSpiMock>();
+    EXPECT_CALL(*batchReaderSpi.get(), getName())
+        .WillRepeatedly(ReturnRef(READER_NAME));
+    EXPECT_CALL(*batchReaderSpi.get(), isPhysicalChannelOpen())
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(
+        *batchReaderSpi.get(),
+        transmitApdus(std::vector<std::vector<uint8_t>>(
+            {requestApdu, case4RequestApdu})))
+        .WillOnce(Return(std::vector<std::vector<uint8_t>>(2, responseApdu)));
+    EXPECT_CALL(*batchReaderSpi.get(), transmitApdu(requestApdu))
+        .WillOnce(Return(responseApdu));
+
+    LocalReaderAdapter localReaderAdapter(batchReaderSpi, PLUGIN_NAME);
+    localReaderAdapter.doRegister();
+    auto response = localReaderAdapter.transmitCardRequest(
+        cardRequestSpi, ChannelControl::KEEP_OPEN);
+
+    ASSERT_EQ(response->getApduResponses().size(), 3u);
+
+    tearDown();
+}
+
+TEST(
+    LocalReaderAdapterTest,
+    transmitCardRequest_withBatchReader_whenTooManyResponses_shouldThrow_RBCE)
+{
+    setUp();
+
+    const std::vector<uint8_t> requestApdu = HexUtil::toByteArray("00B2010400");
+
+    EXPECT_CALL(*apduRequestSpi.get(), getApdu())
+        .WillRepeatedly(Return(requestApdu));
+    apduRequests.push_back(apduRequestSpi);
+
+    auto batchReaderSpi = std::make_shared<BatchTransmitReaderSpiMock>();
+    EXPECT_CALL(*batchReaderSpi.get(), getName())
+        .WillRepeatedly(ReturnRef(READER_NAME));
+    EXPECT_CALL(*batchReaderSpi.get(), isPhysicalChannelOpen())
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*batchReaderSpi.get(), closePhysicalChannel())
+        .WillRepeatedly(Return());
+    EXPECT_CALL(*batchReaderSpi.get(), transmitApdus(_))
+        .WillOnce(Return(std::vector<std::vector<uint8_t>>(
+            3, HexUtil::toByteArray("9000"))));
+
+    LocalReaderAdapter localReaderAdapter(batchReaderSpi, PLUGIN_NAME);
+    localReaderAdapter.doRegister();
+
+    EXPECT_THROW(
+        localReaderAdapter.transmitCardRequest(
+            cardRequestSpi, ChannelControl::KEEP_OPEN),
+        ReaderBrokenCommunicationException);
+
+    tearDown();
+}
+
 TEST(
     LocalReaderAdapterTest,
     transmitCardRequest_withUnsuccessfulStatusWord_shouldThrow_USW)
@@ -757,6 +1037,43 @@ TEST(
     tearDown();
 }
 
+TEST(
+    LocalReaderAdapterTest,
+    tryTransmitCardRequest_withUnsuccessfulStatusWord_shouldReturnStatus)
+{
+    setUp();
+
+    const std::vector<uint8_t> responseApdu
+        = HexUtil::toByteArray("123456789000");
+    std::vector<uint8_t> requestApdu = HexUtil::toByteArray("0000");
+    const std::vector<int> resp = {0x9001};
+
+    EXPECT_CALL(*readerSpi.get(), transmitApdu(_))
+        .WillRepeatedly(Return(responseApdu));
+    EXPECT_CALL(*apduRequestSpi.get(), getApdu())
+        .WillRepeatedly(Return(requestApdu));
+    EXPECT_CALL(*apduRequestSpi.get(), getSuccessfulStatusWords())
+        .WillRepeatedly(ReturnRef(resp));
+    EXPECT_CALL(*cardRequestSpi.get(), stopOnUnsuccessfulStatusWord())
+        .WillRepeatedly(Return(true));
+
+    LocalReaderAdapter localReaderAdapter(readerSpi, PLUGIN_NAME);
+    localReaderAdapter.doRegister();
+
+    const CardRequestResult result = localReaderAdapter.tryTransmitCardRequest(
+        cardRequestSpi, ChannelControl::CLOSE_AFTER);
+
+    ASSERT_EQ(
+        result.getStatus(), CardRequestResult::Status::UNEXPECTED_STATUS_WORD);
+    ASSERT_TRUE(result.isCardResponseComplete());
+    ASSERT_EQ(result.getCardResponse()->getApduResponses().size(), 1u);
+    ASSERT_EQ(
+        result.getCardResponse()->getApduResponses()[0]->getApdu(),
+        responseApdu);
+
+    tearDown();
+}
+
 TEST(
     LocalReaderAdapterTest,
     transmitCardRequest_withCardExceptionOnTransmit_shouldThrow_CBCE)
@@ -11,6 +11,7 @@
  * SPDX-License-Identifier: EPL-2.0                                           *
  ******************************************************************************/
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
@@ -19,6 +20,7 @@
 #include "gtest/gtest.h"
 
 #include "keyple/core/service/ObservableLocalPluginAdapter.hpp"
+#include "keyple/core/service/cpp/MonitoringThreadPool.hpp"
 #include "keyple/core/util/cpp/exception/IllegalArgumentException.hpp"
 #include "keyple/core/util/cpp/exception/IllegalStateException.hpp"
 
@@ -29,6 +31,7 @@
 #include "mock/ReaderSpiMock.hpp"
 
 using keyple::core::service::ObservableLocalPluginAdapter;
+using keyple::core::service::cpp::MonitoringThreadPool;
 using keyple::core::util::cpp::exception::IllegalArgumentException;
 using keyple::core::util::cpp::exception::IllegalStateException;
 
@@ -317,3 +320,57 @@ TEST(
 
     tearDown();
 }
+
+class BlockingPluginObserver final : public PluginObserverSpi {
+public:
+    void
+    onPluginEvent(const std::shared_ptr<PluginEvent> pluginEvent) final
+    {
+        while (!mRelease) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        if (pluginEvent->getType() == PluginEvent::Type::UNAVAILABLE) {
+            mUnavailableReceived = true;
+        }
+    }
+
+    std::atomic<bool> mRelease{false};
+    std::atomic<bool> mUnavailableReceived{false};
+};
+
+TEST(
+    ObservableLocalPluginAdapterTest,
+    doUnregister_whenNotificationPending_shouldKeepPluginAlive)
+{
+    setUp();
+
+    auto threadPool = std::make_shared<MonitoringThreadPool>(1, 100);
+    auto observer = std::make_shared<BlockingPluginObserver>();
+
+    pluginAdapter->setEventNotificationThreadPool(threadPool);
+    pluginAdapter->doRegister();
+    pluginAdapter->addObserver(observer);
+
+    /* The observer blocks the UNAVAILABLE notification */
+    pluginAdapter->doUnregister();
+
+    const std::weak_ptr<ObservableLocalPluginAdapter> plugin = pluginAdapter;
+    pluginAdapter.reset();
+
+    ASSERT_FALSE(plugin.expired());
+
+    observer->mRelease = true;
+
+    for (int i = 0; i < 1000 && !plugin.expired(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    ASSERT_TRUE(observer->mUnavailableReceived);
+    ASSERT_TRUE(plugin.expired());
+
+    threadPool->shutdown();
+    observablePluginMock.reset();
+    observerMock.reset();
+    exceptionHandlerMock.reset();
+}
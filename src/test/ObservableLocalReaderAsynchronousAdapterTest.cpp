@@ -19,6 +19,7 @@
 
 #include "keyple/core/service/ObservableLocalReaderAdapter.hpp"
 #include "keyple/core/service/cpp/ExecutorService.hpp"
+#include "keyple/core/service/cpp/MonitoringThreadPool.hpp"
 #include "keyple/core/util/cpp/LoggerFactory.hpp"
 #include "keypop/card/CardResponseApi.hpp"
 #include "keypop/card/CardSelectionResponseApi.hpp"
@@ -42,6 +43,8 @@
 
 using keyple::core::service::ObservableLocalReaderAdapter;
 using keyple::core::service::cpp::ExecutorService;
+using keyple::core::service::cpp::LatencyHistogram;
+using keyple::core::service::cpp::MonitoringThreadPool;
 using keyple::core::util::cpp::LoggerFactory;
 using keypop::card::CardResponseApi;
 using keypop::card::CardSelectionResponseApi;
@@ -201,3 +204,159 @@ TEST(
 
     tearDown();
 }
+
+TEST(
+    ObservableLocalReaderAsynchronousAdapterTest,
+    bouncingCard_duringProcessing_shouldCoalesceInsertion)
+{
+    setUp();
+
+    /* The card bounces while the first insertion is being notified */
+    class BouncingCardObserver final : public CardReaderObserverSpi {
+    public:
+        void
+        onReaderEvent(const std::shared_ptr<CardReaderEvent> readerEvent)
+            override
+        {
+            if (readerEvent->getType() == CardReaderEvent::Type::CARD_INSERTED
+                && !mBounced) {
+                mBounced = true;
+                readerSpi->setCardPresent(false);
+                readerSpi->setCardPresent(true);
+                readerSpi->setCardPresent(false);
+            }
+        }
+
+    private:
+        bool mBounced = false;
+    };
+
+    _reader->setReaderObservationExceptionHandler(handler);
+    _reader->addObserver(std::make_shared<BouncingCardObserver>());
+    _reader->startCardDetection(ObservableCardReader::DetectionMode::REPEATING);
+    readerSpi->setCardPresent(true);
+
+    ASSERT_EQ(_reader->getCoalescedEventCount(), 1);
+    ASSERT_EQ(_reader->getMaxEventQueueDepth(), 2);
+    ASSERT_EQ(_reader->getEventQueueDepth(), 0);
+    ASSERT_EQ(
+        _reader->getCurrentMonitoringState(),
+        MonitoringState::WAIT_FOR_CARD_INSERTION);
+
+    tearDown();
+}
+
+TEST(
+    ObservableLocalReaderAsynchronousAdapterTest,
+    insertCard_whenProcessingNotFinalized_shouldTimeOut)
+{
+    setUp();
+
+    _reader->setCardProcessingTimeout(50);
+    testSuite->insertCard_onWaitForCard_shouldNotify_CardInsertedEvent();
+
+    ASSERT_EQ(_reader->getMissedProcessingDeadlineCount(), 1);
+    ASSERT_EQ(
+        _reader->getCurrentMonitoringState(),
+        MonitoringState::WAIT_FOR_CARD_REMOVAL);
+
+    tearDown();
+}
+
+TEST(
+    ObservableLocalReaderAsynchronousAdapterTest,
+    finalizeCardProcessing_afterInsert_shouldCountTransitions)
+{
+    setUp();
+
+    testSuite->finalizeCardProcessing_afterInsert_switchState();
+
+    ASSERT_EQ(
+        _reader->getTransitionCount(
+            MonitoringState::WAIT_FOR_START_DETECTION,
+            ObservableLocalReaderAdapter::InternalEvent::START_DETECT),
+        1);
+    ASSERT_EQ(
+        _reader->getTransitionCount(
+            MonitoringState::WAIT_FOR_CARD_INSERTION,
+            ObservableLocalReaderAdapter::InternalEvent::CARD_INSERTED),
+        1);
+    ASSERT_EQ(
+        _reader->getTransitionCount(
+            MonitoringState::WAIT_FOR_CARD_PROCESSING,
+            ObservableLocalReaderAdapter::InternalEvent::CARD_PROCESSED),
+        1);
+    ASSERT_GE(
+        _reader->getTimeInState(MonitoringState::WAIT_FOR_CARD_PROCESSING),
+        1000);
+
+    tearDown();
+}
+
+TEST(
+    ObservableLocalReaderAsynchronousAdapterTest,
+    insertCard_shouldRecordTapToEventLatency)
+{
+    setUp();
+
+    testSuite->insertCard_onWaitForCard_shouldNotify_CardInsertedEvent();
+
+    const LatencyHistogram& tapToEvent = _reader->getLatencyHistogram(
+        ObservableLocalReaderAdapter::LatencyStage::TAP_TO_EVENT);
+    ASSERT_EQ(tapToEvent.getCount(), 1);
+    ASSERT_GE(
+        tapToEvent.getMax(),
+        _reader
+            ->getLatencyHistogram(
+                ObservableLocalReaderAdapter::LatencyStage::CARD_DETECTION)
+            .getMax());
+    ASSERT_EQ(
+        _reader
+            ->getLatencyHistogram(
+                ObservableLocalReaderAdapter::LatencyStage::CARD_SELECTION)
+            .getCount(),
+        0);
+
+    tearDown();
+}
+
+TEST(
+    ObservableLocalReaderAsynchronousAdapterTest,
+    removeCard_shouldNotRecordTapToEventLatency)
+{
+    setUp();
+
+    testSuite->removeCard_afterFinalize_shouldNotify_CardRemoved();
+
+    ASSERT_EQ(
+        _reader
+            ->getLatencyHistogram(
+                ObservableLocalReaderAdapter::LatencyStage::TAP_TO_EVENT)
+            .getCount(),
+        1);
+
+    tearDown();
+}
+
+TEST(
+    ObservableLocalReaderAsynchronousAdapterTest,
+    insertCard_withNotificationPool_shouldRecordTapToEventLatencyOnDelivery)
+{
+    auto threadPool = std::make_shared<MonitoringThreadPool>(1, 100);
+
+    setUp();
+
+    _reader->setEventNotificationThreadPool(threadPool);
+    testSuite->insertCard_onWaitForCard_shouldNotify_CardInsertedEvent();
+
+    ASSERT_EQ(
+        _reader
+            ->getLatencyHistogram(
+                ObservableLocalReaderAdapter::LatencyStage::TAP_TO_EVENT)
+            .getCount(),
+        1);
+
+    tearDown();
+
+    threadPool->shutdown();
+}
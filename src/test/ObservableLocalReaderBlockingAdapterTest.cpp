@@ -140,3 +140,19 @@ TEST(
 
     tearDown();
 }
+
+TEST(
+    ObservableLocalReaderBlockingAdapterTest,
+    insertCard_whenRemovalMonitoringBlocks_shouldTimeOut)
+{
+    setUp();
+
+    readerSpi->setMonitorPresenceUntilStopped(true);
+    _reader->setCardProcessingTimeout(50);
+    testSuite->insertCard_onWaitForCard_shouldNotify_CardInsertedEvent();
+
+    /* The blocked card presence monitoring job must not delay the timeout */
+    ASSERT_EQ(_reader->getMissedProcessingDeadlineCount(), 1);
+
+    tearDown();
+}
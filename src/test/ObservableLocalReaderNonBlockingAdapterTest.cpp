@@ -11,6 +11,7 @@
  * SPDX-License-Identifier: EPL-2.0                                           *
  ******************************************************************************/
 
+#include <atomic>
 #include <memory>
 #include <string>
 
@@ -18,7 +19,10 @@
 #include "gtest/gtest.h"
 
 #include "keyple/core/service/ObservableLocalReaderAdapter.hpp"
+#include "keyple/core/service/cpp/MonitoringThreadPool.hpp"
+#include "keyple/core/service/spi/PollingPolicySpi.hpp"
 #include "keyple/core/util/cpp/LoggerFactory.hpp"
+#include "keyple/core/util/cpp/exception/IllegalStateException.hpp"
 
 /* Mock */
 #include "mock/CardReaderObservationExceptionHandlerSpiMock.hpp"
@@ -33,7 +37,10 @@ using testing::Return;
 using testing::ReturnRef;
 
 using keyple::core::service::ObservableLocalReaderAdapter;
+using keyple::core::service::cpp::MonitoringThreadPool;
+using keyple::core::service::spi::PollingPolicySpi;
 using keyple::core::util::cpp::LoggerFactory;
+using keyple::core::util::cpp::exception::IllegalStateException;
 
 static const std::string PLUGIN_NAME = "plugin";
 
@@ -47,6 +54,41 @@ static std::shared_ptr<ReaderObserverSpiMock> observer;
 static std::shared_ptr<CardReaderObservationExceptionHandlerSpiMock> handler;
 static std::shared_ptr<ObservableLocalReaderSuite> testSuite;
 
+class FixedDelayPollingPolicy final : public PollingPolicySpi {
+public:
+    explicit FixedDelayPollingPolicy(const long delayMillis)
+    : mDelayMillis(delayMillis)
+    , mInsertionCallCount(0)
+    {
+    }
+
+    long
+    getNextPollDelay(
+        const bool monitorInsertion,
+        const int pollCount,
+        const long defaultDelayMillis) override
+    {
+        (void)pollCount;
+        (void)defaultDelayMillis;
+
+        if (monitorInsertion) {
+            mInsertionCallCount++;
+        }
+
+        return mDelayMillis;
+    }
+
+    int
+    getInsertionCallCount() const
+    {
+        return mInsertionCallCount;
+    }
+
+private:
+    const long mDelayMillis;
+    std::atomic<int> mInsertionCallCount;
+};
+
 static void
 setUp()
 {
@@ -122,6 +164,22 @@ TEST(
     tearDown();
 }
 
+TEST(
+    ObservableLocalReaderNonBlockingAdapterTest,
+    insertCard_withNotificationPool_shouldNotify_CardInsertedEvent)
+{
+    auto threadPool = std::make_shared<MonitoringThreadPool>(1, 100);
+
+    setUp();
+
+    _reader->setEventNotificationThreadPool(threadPool);
+    __insertCard_shouldNotify_CardInsertedEvent();
+
+    tearDown();
+
+    threadPool->shutdown();
+}
+
 TEST(
     ObservableLocalReaderNonBlockingAdapterTest,
     finalizeCardProcessing_afterInsert_switchState)
@@ -164,3 +222,95 @@ TEST(
 
     tearDown();
 }
+
+TEST(
+    ObservableLocalReaderNonBlockingAdapterTest,
+    setPollingPolicy_shouldPaceInsertionPolls)
+{
+    setUp();
+
+    /* The plugin asks for a poll every 10 ms, the policy for one per 10 s */
+    const auto pollingPolicy
+        = std::make_shared<FixedDelayPollingPolicy>(10000);
+    _reader->setPollingPolicy(pollingPolicy);
+    _reader->startCardDetection(ObservableCardReader::DetectionMode::REPEATING);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    ASSERT_EQ(pollingPolicy->getInsertionCallCount(), 1);
+
+    /* Not polled again, the card is not detected */
+    readerSpi->setCardPresent(true);
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    ASSERT_EQ(
+        _reader->getCurrentMonitoringState(),
+        MonitoringState::WAIT_FOR_CARD_INSERTION);
+
+    tearDown();
+}
+
+TEST(
+    ObservableLocalReaderNonBlockingAdapterTest,
+    getNextPollDelay_whenPolicyReturnsZero_shouldReturnMinimumDelay)
+{
+    setUp();
+
+    _reader->setPollingPolicy(std::make_shared<FixedDelayPollingPolicy>(0));
+
+    ASSERT_EQ(_reader->getNextPollDelay(true, 1, 10), 1);
+
+    _reader->setPollingPolicy(nullptr);
+
+    ASSERT_EQ(_reader->getNextPollDelay(true, 1, 10), 10);
+
+    tearDown();
+}
+
+TEST(
+    ObservableLocalReaderNonBlockingAdapterTest,
+    isCardPresentPing_withoutProbeApdu_shouldCheckCardPresence)
+{
+    setUp();
+
+    _reader->setCardPresenceProbeApdu({});
+
+    readerSpi->setCardPresent(true);
+    ASSERT_TRUE(_reader->isCardPresentPing());
+
+    readerSpi->setCardPresent(false);
+    ASSERT_FALSE(_reader->isCardPresentPing());
+
+    ASSERT_EQ(_reader->getCardPresenceProbeCount(), 2);
+
+    tearDown();
+}
+
+TEST(
+    ObservableLocalReaderNonBlockingAdapterTest,
+    isCardPresentPing_whenReaderFails_shouldRecordProbe)
+{
+    setUp();
+
+    _reader->setCardPresenceProbeApdu({});
+
+    readerSpi->setReaderFailing(true);
+    ASSERT_FALSE(_reader->isCardPresentPing());
+
+    ASSERT_EQ(_reader->getCardPresenceProbeCount(), 1);
+
+    tearDown();
+}
+
+TEST(
+    ObservableLocalReaderNonBlockingAdapterTest,
+    setCardPresenceProbeApdu_whenDetectionStarted_shouldISE)
+{
+    setUp();
+
+    _reader->startCardDetection(ObservableCardReader::DetectionMode::REPEATING);
+
+    EXPECT_THROW(_reader->setCardPresenceProbeApdu({}), IllegalStateException);
+
+    tearDown();
+}
@@ -11,6 +11,7 @@
  * SPDX-License-Identifier: EPL-2.0                                           *
  ******************************************************************************/
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -30,7 +31,9 @@
 #include "keyple/core/service/KeyplePluginException.hpp"
 #include "keyple/core/service/LocalPluginAdapter.hpp"
 #include "keyple/core/service/LocalPoolPluginAdapter.hpp"
+#include "keyple/core/service/MonitoringState.hpp"
 #include "keyple/core/service/ObservableLocalPluginAdapter.hpp"
+#include "keyple/core/service/ObservableLocalReaderAdapter.hpp"
 #include "keyple/core/service/ObservablePlugin.hpp"
 #include "keyple/core/service/Plugin.hpp"
 #include "keyple/core/service/PoolPlugin.hpp"
@@ -39,6 +42,7 @@
 #include "keyple/core/util/cpp/exception/IllegalArgumentException.hpp"
 #include "keyple/core/util/cpp/exception/IllegalStateException.hpp"
 #include "keypop/reader/CardReader.hpp"
+#include "keypop/reader/ObservableCardReader.hpp"
 #include "keypop/reader/ReaderApiFactory.hpp"
 
 /* Mock */
@@ -46,6 +50,7 @@
 #include "mock/CardExtensionMock.hpp"
 #include "mock/CardReaderMock.hpp"
 #include "mock/ObservablePluginSpiMock.hpp"
+#include "mock/ObservableReaderAsynchronousSpiMock.hpp"
 #include "mock/PluginFactoryMock.hpp"
 #include "mock/PluginSpiMock.hpp"
 #include "mock/PoolPluginFactoryMock.hpp"
@@ -60,7 +65,9 @@ using keyple::core::service::AutonomousObservableLocalPluginAdapter;
 using keyple::core::service::KeyplePluginException;
 using keyple::core::service::LocalPluginAdapter;
 using keyple::core::service::LocalPoolPluginAdapter;
+using keyple::core::service::MonitoringState;
 using keyple::core::service::ObservableLocalPluginAdapter;
+using keyple::core::service::ObservableLocalReaderAdapter;
 using keyple::core::service::ObservablePlugin;
 using keyple::core::service::Plugin;
 using keyple::core::service::PoolPlugin;
@@ -69,6 +76,7 @@ using keyple::core::util::cpp::Arrays;
 using keyple::core::util::cpp::exception::IllegalArgumentException;
 using keyple::core::util::cpp::exception::IllegalStateException;
 using keypop::reader::CardReader;
+using keypop::reader::ObservableCardReader;
 using keypop::reader::ReaderApiFactory;
 
 using testing::_;
@@ -950,6 +958,68 @@ TEST(
     tearDown();
 }
 
+TEST(
+    SmartCardServiceAdapterTest,
+    getMonitoringStateSnapshot_whenNoObservableReader_shouldBeEmpty)
+{
+    setUp();
+
+    service->registerPlugin(pluginFactory);
+
+    ASSERT_TRUE(service->getMonitoringStateSnapshot().empty());
+
+    tearDown();
+}
+
+TEST(
+    SmartCardServiceAdapterTest,
+    getMonitoringStateSnapshot_whenStateSwitched_shouldReturnCurrentState)
+{
+    setUp();
+
+    const auto observableReader
+        = std::make_shared<ObservableReaderAsynchronousSpiMock>(READER_NAME);
+    const std::vector<std::shared_ptr<ReaderSpi>> readers = {observableReader};
+    EXPECT_CALL(*plugin, searchAvailableReaders())
+        .WillRepeatedly(Return(readers));
+
+    service->registerPlugin(pluginFactory);
+
+    const auto localReader
+        = std::dynamic_pointer_cast<ObservableLocalReaderAdapter>(
+            service->getPlugin(PLUGIN_NAME)->getReader(READER_NAME));
+    ASSERT_NE(localReader, nullptr);
+    ASSERT_EQ(
+        service->getMonitoringStateSnapshot().at(READER_NAME),
+        MonitoringState::WAIT_FOR_START_DETECTION);
+
+    localReader->startCardDetection(
+        ObservableCardReader::DetectionMode::REPEATING);
+    ASSERT_EQ(
+        service->getMonitoringStateSnapshot().at(READER_NAME),
+        MonitoringState::WAIT_FOR_CARD_INSERTION);
+
+    /* The asynchronous reader processes the insertion in the calling thread */
+    observableReader->setCardPresent(true);
+    ASSERT_EQ(
+        service->getMonitoringStateSnapshot().at(READER_NAME),
+        MonitoringState::WAIT_FOR_CARD_PROCESSING);
+
+    localReader->finalizeCardProcessing();
+    ASSERT_EQ(
+        service->getMonitoringStateSnapshot().at(READER_NAME),
+        MonitoringState::WAIT_FOR_CARD_REMOVAL);
+
+    localReader->stopCardDetection();
+    const std::map<std::string, MonitoringState> snapshot
+        = service->getMonitoringStateSnapshot();
+    ASSERT_EQ(snapshot.size(), 1);
+    ASSERT_EQ(
+        snapshot.at(READER_NAME), MonitoringState::WAIT_FOR_START_DETECTION);
+
+    tearDown();
+}
+
 /* Check card extension APIs */
 
 TEST(
@@ -0,0 +1,69 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "keyple/core/service/cpp/TimerWheel.hpp"
+
+using keyple::core::service::cpp::TimerWheel;
+
+static bool
+waitForCount(const std::atomic<int>& count, const int expected)
+{
+    for (int i = 0; i < 1000; i++) {
+        if (count >= expected) {
+            return true;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    return false;
+}
+
+TEST(TimerWheelTest, schedule_whenDelayElapsed_shouldRunTask)
+{
+    std::atomic<int> count(0);
+    auto timerWheel = std::make_shared<TimerWheel>(1, 16);
+
+    /* Delays longer than one revolution of the wheel are supported */
+    timerWheel->schedule([&count]() { count++; }, 5);
+    timerWheel->schedule([&count]() { count++; }, 40);
+
+    ASSERT_TRUE(waitForCount(count, 2));
+
+    timerWheel->shutdown();
+}
+
+TEST(TimerWheelTest, cancel_whenTaskPending_shouldNotRunTask)
+{
+    std::atomic<int> count(0);
+    std::atomic<int> cancelledCount(0);
+    auto timerWheel = std::make_shared<TimerWheel>(1, 16);
+
+    auto timeout
+        = timerWheel->schedule([&cancelledCount]() { cancelledCount++; }, 20);
+    timerWheel->schedule([&count]() { count++; }, 40);
+    timeout->cancel();
+
+    ASSERT_TRUE(waitForCount(count, 1));
+    ASSERT_EQ(cancelledCount, 0);
+
+    timerWheel->shutdown();
+}
@@ -0,0 +1,72 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "keyple/core/service/cpp/TransactionArena.hpp"
+
+using keyple::core::service::cpp::ArenaAllocator;
+using keyple::core::service::cpp::TransactionArena;
+
+TEST(TransactionArenaTest, allocate_afterReset_shouldReuseMemory)
+{
+    TransactionArena arena(64);
+
+    void* first = arena.allocate(24, 8);
+    void* second = arena.allocate(24, 8);
+
+    ASSERT_NE(first, second);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(second) % 8, 0u);
+
+    arena.reset();
+
+    ASSERT_EQ(arena.allocate(24, 8), first);
+    ASSERT_EQ(arena.getBlockCount(), 1u);
+}
+
+TEST(TransactionArenaTest, allocate_whenBlockIsFull_shouldAddBlock)
+{
+    TransactionArena arena(64);
+
+    arena.allocate(48, 8);
+    arena.allocate(48, 8);
+    arena.allocate(256, 8);
+
+    ASSERT_EQ(arena.getBlockCount(), 3u);
+
+    /* The blocks are kept */
+    arena.reset();
+    arena.allocate(48, 8);
+    arena.allocate(48, 8);
+
+    ASSERT_EQ(arena.getBlockCount(), 3u);
+}
+
+TEST(TransactionArenaTest, allocateShared_shouldKeepArenaAlive)
+{
+    std::shared_ptr<TransactionArena> arena
+        = std::make_shared<TransactionArena>(256);
+
+    std::shared_ptr<std::vector<int>> object
+        = std::allocate_shared<std::vector<int>>(
+            ArenaAllocator<std::vector<int>>(arena), 3, 7);
+    arena = nullptr;
+
+    ASSERT_EQ(object->size(), 3u);
+    ASSERT_EQ((*object)[2], 7);
+}
@@ -0,0 +1,47 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#pragma once
+
+#include <memory>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "keypop/card/CardSelectionResponseApi.hpp"
+#include "keypop/card/spi/CardSelectionExtensionSpi.hpp"
+#include "keypop/card/spi/CardSelectionRequestSpi.hpp"
+#include "keypop/card/spi/SmartCardSpi.hpp"
+#include "keypop/reader/selection/spi/CardSelectionExtension.hpp"
+
+using keypop::card::CardSelectionResponseApi;
+using keypop::card::spi::CardSelectionExtensionSpi;
+using keypop::card::spi::CardSelectionRequestSpi;
+using keypop::card::spi::SmartCardSpi;
+using keypop::reader::selection::spi::CardSelectionExtension;
+
+class CardSelectionExtensionMock final : public CardSelectionExtension,
+                                         public CardSelectionExtensionSpi {
+public:
+    MOCK_METHOD(
+        const std::shared_ptr<CardSelectionRequestSpi>,
+        getCardSelectionRequest,
+        (),
+        (override));
+    MOCK_METHOD(
+        const std::shared_ptr<SmartCardSpi>,
+        parse,
+        (const std::shared_ptr<CardSelectionResponseApi>
+             cardSelectionResponseApi),
+        (override));
+};
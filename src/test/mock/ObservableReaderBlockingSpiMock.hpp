@@ -13,6 +13,8 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -65,6 +67,8 @@ public:
     , mCardPresent(false)
     , mInsertions(0)
     , mRemovals(0)
+    , mMonitorPresenceUntilStopped(false)
+    , mPresenceMonitoringStopped(false)
     , mWaitInsertion(waitInsertion)
     , mWaitRemoval(waitRemoval)
     , mName(name)
@@ -77,6 +81,16 @@ public:
         mCardPresent = cardPresent;
     }
 
+    /**
+     * When set, the card presence monitoring during processing only returns
+     * when stopped
+     */
+    void
+    setMonitorPresenceUntilStopped(const bool monitorPresenceUntilStopped)
+    {
+        mMonitorPresenceUntilStopped = monitorPresenceUntilStopped;
+    }
+
     void
     onStartDetection()
     {
@@ -231,13 +245,28 @@ public:
     void
     monitorCardPresenceDuringProcessing()
     {
-        waitForCardRemoval();
+        if (!mMonitorPresenceUntilStopped) {
+            waitForCardRemoval();
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(mPresenceMonitoringMutex);
+        mPresenceMonitoringCondition.wait(
+            lock, [this] { return mPresenceMonitoringStopped; });
+        mPresenceMonitoringStopped = false;
     }
 
     void
     stopCardPresenceMonitoringDuringProcessing()
     {
-        stopWaitForCardRemoval();
+        if (!mMonitorPresenceUntilStopped) {
+            stopWaitForCardRemoval();
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mPresenceMonitoringMutex);
+        mPresenceMonitoringStopped = true;
+        mPresenceMonitoringCondition.notify_all();
     }
 
 private:
@@ -246,6 +275,10 @@ private:
     std::atomic<bool> mCardPresent;
     std::atomic<int> mInsertions;
     std::atomic<int> mRemovals;
+    std::atomic<bool> mMonitorPresenceUntilStopped;
+    bool mPresenceMonitoringStopped;
+    std::mutex mPresenceMonitoringMutex;
+    std::condition_variable mPresenceMonitoringCondition;
     int64_t mWaitInsertion;
     int64_t mWaitRemoval;
     std::string mName;
@@ -124,6 +124,10 @@ public:
     bool
     checkCardPresence()
     {
+        if (mReaderFailing) {
+            throw ReaderIOException("reader disconnected");
+        }
+
         return mCardPresent;
     }
 
@@ -163,6 +167,12 @@ public:
         mCardPresent = cardPresent;
     }
 
+    void
+    setReaderFailing(const bool readerFailing)
+    {
+        mReaderFailing = readerFailing;
+    }
+
     int
     getCardInsertionMonitoringSleepDuration() const
     {
@@ -179,5 +189,6 @@ private:
     bool mDetectionStarted = false;
     bool mPhysicalChannelOpen = false;
     std::atomic<bool> mCardPresent {false};
+    std::atomic<bool> mReaderFailing {false};
     std::string mName;
 };